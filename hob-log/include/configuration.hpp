@@ -27,6 +27,7 @@
 #ifndef HOB_LOG_STRIP_ALL
 
 #include <string_view>
+#include <cstddef>
 
 /******************************************************************************************************
  * CONSTANTS
@@ -65,6 +66,11 @@ inline constexpr std::string_view LOG_TAG_DEBUG = "debug";
  *****************************************************************************************************/
 inline constexpr std::string_view LOG_TAG_TRACE = "trace";
 
+/** ***************************************************************************************************
+ * @brief How many bytes of a binary blob are copied and rendered by default (@see hexdump()).
+ *****************************************************************************************************/
+inline constexpr std::size_t BLOB_TRUNCATION_LENGTH = 256UL;
+
 } /*< namespace hob::log */
 
 #endif /*< HOB_LOG_STRIP_ALL */
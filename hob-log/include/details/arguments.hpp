@@ -0,0 +1,225 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file arguments.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the binary encoding of the arguments of a log, allowing them to be
+ * formatted later (possibly on another thread) than the moment they have been logged.
+ * @details Arithmetic and enumeration arguments are being copied byte by byte and string arguments are
+ * being copied as their length followed by their characters. Binary blobs (@see blob.hpp) are copied as
+ * the length of the whole buffer, the encoding and the length of the truncated bytes followed by them.
+ * Any other type (even a trivially copyable one, since it might refer to memory it does not own, e.g.
+ * std::span or an iterator) is not encoded, the message being formatted when it is logged instead.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_DETAILS_ARGUMENTS_HPP_
+#define HOB_LOG_DETAILS_ARGUMENTS_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_STRIP_ALL
+
+#include <array>
+#include <tuple>
+#include <string>
+#include <format>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "blob.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log::details
+{
+
+/** ***************************************************************************************************
+ * @brief Function that formats the encoded arguments according to the format they have been logged
+ * with.
+ * @param destination: The string the formatted message will be appended to.
+ * @param format: String that contains the text to be written.
+ * @param arguments: The encoded arguments.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ * @throws std::format_error: If an argument can not be formatted (e.g. a negative dynamic width or a
+ * formatter that throws).
+ *****************************************************************************************************/
+using decoder = void (*)(std::string& destination, std::string_view format, std::string_view arguments);
+
+/** ***************************************************************************************************
+ * @brief Checks if an argument is encoded as a string (its characters are copied).
+ *****************************************************************************************************/
+template<typename TYPE>
+inline constexpr bool is_string_argument_v = std::is_convertible_v<const std::decay_t<TYPE>&, std::string_view>;
+
+/** ***************************************************************************************************
+ * @brief Checks if an argument is encoded as a binary blob (its bytes are copied).
+ *****************************************************************************************************/
+template<typename TYPE>
+inline constexpr bool is_blob_argument_v = std::is_same_v<blob, std::decay_t<TYPE>>;
+
+/** ***************************************************************************************************
+ * @brief Checks if an argument is encoded as its value (its bytes are copied and it does not refer to
+ * any other memory).
+ *****************************************************************************************************/
+template<typename TYPE>
+inline constexpr bool is_value_argument_v = true == std::is_arithmetic_v<std::decay_t<TYPE>> || true == std::is_enum_v<std::decay_t<TYPE>>;
+
+/** ***************************************************************************************************
+ * @brief Checks if an argument can be encoded, otherwise the message needs to be formatted eagerly.
+ *****************************************************************************************************/
+template<typename TYPE>
+inline constexpr bool is_serializable_v = true == is_string_argument_v<TYPE> || true == is_blob_argument_v<TYPE> || true == is_value_argument_v<TYPE>;
+
+/** ***************************************************************************************************
+ * @brief The type an argument is being decoded as (strings and blobs are viewed inside the encoded
+ * arguments).
+ *****************************************************************************************************/
+template<typename TYPE>
+using decoded_argument_t = std::conditional_t<is_string_argument_v<TYPE>, std::string_view, std::decay_t<TYPE>>;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Appends the encoding of an argument to the destination.
+ * @tparam TYPE: The type of the argument (needs to be serializable).
+ * @param destination: The string the encoding will be appended to.
+ * @param argument: The argument to be encoded.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+template<typename TYPE>
+void serialize_argument(std::string& destination, const TYPE& argument) noexcept(false)
+{
+	if constexpr (true == is_blob_argument_v<TYPE>)
+	{
+		const std::size_t bytes_length = argument.bytes.size();
+
+		(void)destination.append(reinterpret_cast<const char*>(&argument.length), sizeof(argument.length));
+		destination.push_back(static_cast<char>(argument.encoding));
+		(void)destination.append(reinterpret_cast<const char*>(&bytes_length), sizeof(bytes_length));
+		(void)destination.append(reinterpret_cast<const char*>(argument.bytes.data()), bytes_length);
+	}
+	else if constexpr (true == is_string_argument_v<TYPE>)
+	{
+		const std::string_view string = argument;
+		const std::size_t	   length = string.length();
+
+		(void)destination.append(reinterpret_cast<const char*>(&length), sizeof(length));
+		(void)destination.append(string);
+	}
+	else
+	{
+		const std::decay_t<TYPE> value = argument;
+		(void)destination.append(reinterpret_cast<const char*>(std::addressof(value)), sizeof(value));
+	}
+}
+
+/** ***************************************************************************************************
+ * @brief Decodes the argument at the beginning of the encoded arguments and removes it.
+ * @tparam TYPE: The type the argument had when it has been logged.
+ * @param arguments: The remaining encoded arguments.
+ * @returns The decoded argument.
+ * @throws N/A.
+ *****************************************************************************************************/
+template<typename TYPE>
+[[nodiscard]] decoded_argument_t<TYPE> deserialize_argument(std::string_view& arguments) noexcept
+{
+	if constexpr (true == is_blob_argument_v<TYPE>)
+	{
+		blob		blob		 = {};
+		std::size_t bytes_length = 0UL;
+
+		(void)std::memcpy(&blob.length, arguments.data(), sizeof(blob.length));
+		arguments.remove_prefix(sizeof(blob.length));
+
+		blob.encoding = static_cast<blob_encoding>(arguments.front());
+		arguments.remove_prefix(1UL);
+
+		(void)std::memcpy(&bytes_length, arguments.data(), sizeof(bytes_length));
+		arguments.remove_prefix(sizeof(bytes_length));
+
+		blob.bytes = std::span<const std::byte>{ reinterpret_cast<const std::byte*>(arguments.data()), bytes_length };
+		arguments.remove_prefix(bytes_length);
+
+		return blob;
+	}
+	else if constexpr (true == is_string_argument_v<TYPE>)
+	{
+		std::size_t length = 0UL;
+
+		(void)std::memcpy(&length, arguments.data(), sizeof(length));
+		arguments.remove_prefix(sizeof(length));
+
+		const std::string_view string = arguments.substr(0UL, length);
+		arguments.remove_prefix(length);
+
+		return string;
+	}
+	else
+	{
+		std::array<char, sizeof(decoded_argument_t<TYPE>)> bytes = {};
+
+		(void)std::memcpy(bytes.data(), arguments.data(), bytes.size());
+		arguments.remove_prefix(bytes.size());
+
+		return std::bit_cast<decoded_argument_t<TYPE>>(bytes);
+	}
+}
+
+/** ***************************************************************************************************
+ * @brief Decodes the arguments and formats them. Its instances are the hob::log::details::decoder
+ * that travel along with the encoded arguments.
+ * @tparam args: The types the arguments had when they have been logged.
+ * @param destination: The string the formatted message will be appended to.
+ * @param format: String that contains the text to be written (it has been checked at compile time).
+ * @param arguments: The encoded arguments.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ * @throws std::format_error: If an argument can not be formatted (e.g. a negative dynamic width or a
+ * formatter that throws).
+ *****************************************************************************************************/
+template<typename... args>
+void deserialize(std::string& destination, const std::string_view format, std::string_view arguments) noexcept(false)
+{
+	// Braced initialization guarantees the arguments are being decoded in order.
+	std::tuple<decoded_argument_t<args>...> values = { deserialize_argument<args>(arguments)... };
+
+	std::apply([&destination, format](auto&... values) -> void
+			   { (void)std::vformat_to(std::back_inserter(destination), format, std::make_format_args(values...)); },
+			   values);
+}
+
+} /*< namespace hob::log::details */
+
+#endif /*< HOB_LOG_STRIP_ALL */
+
+#endif /*< HOB_LOG_DETAILS_ARGUMENTS_HPP_ */
@@ -0,0 +1,269 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file blob.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the binary blobs that can be logged as format arguments, rendered as a
+ * hexdump or as base64 only when the message is being formatted (possibly on the worker thread).
+ * @details The bytes are copied into the encoded arguments only if the message is being logged, no
+ * string being built by the thread that logs it. Only the bytes up to the truncation length are
+ * copied, the length of the whole buffer being kept so the rendering can report what was left out.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_DETAILS_BLOB_HPP_
+#define HOB_LOG_DETAILS_BLOB_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_STRIP_ALL
+
+#include <span>
+#include <format>
+#include <string_view>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "../configuration.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The ways a binary blob can be rendered.
+ *****************************************************************************************************/
+enum class blob_encoding : std::uint8_t
+{
+	HEXDUMP = 0U, /**< Rows of 16 bytes with their offset, hexadecimal values and printable characters. */
+	BASE64	= 1U  /**< The standard base64 alphabet, padded.											   */
+};
+
+/** ***************************************************************************************************
+ * @brief A binary buffer logged as a format argument (@see hexdump() and base64()).
+ *****************************************************************************************************/
+struct blob final
+{
+	std::span<const std::byte> bytes;	 /**< The bytes to be rendered (the buffer, possibly truncated). */
+	std::size_t				   length;	 /**< The length of the whole buffer.							 */
+	blob_encoding			   encoding; /**< How the bytes are being rendered.						 */
+};
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Wraps a binary buffer so it is logged as a hexdump, e.g.
+ * HOB_LOG_DEBUG("network", "Received packet: {}", hob::log::hexdump(packet)). It is thread-safe.
+ * @param bytes: The buffer to be logged (it only needs to outlive the log call).
+ * @param truncation_length: How many bytes are copied and rendered at most.
+ * @returns The argument to be formatted.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] constexpr blob hexdump(const std::span<const std::byte> bytes, const std::size_t truncation_length = BLOB_TRUNCATION_LENGTH) noexcept
+{
+	return blob{ bytes.first(std::min(bytes.size(), truncation_length)), bytes.size(), blob_encoding::HEXDUMP };
+}
+
+/** ***************************************************************************************************
+ * @brief Wraps a binary buffer so it is logged as base64. It is thread-safe.
+ * @param bytes: The buffer to be logged (it only needs to outlive the log call).
+ * @param truncation_length: How many bytes are copied and rendered at most.
+ * @returns The argument to be formatted.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] constexpr blob base64(const std::span<const std::byte> bytes, const std::size_t truncation_length = BLOB_TRUNCATION_LENGTH) noexcept
+{
+	return blob{ bytes.first(std::min(bytes.size(), truncation_length)), bytes.size(), blob_encoding::BASE64 };
+}
+
+} /*< namespace hob::log */
+
+namespace hob::log::details
+{
+
+/** ***************************************************************************************************
+ * @brief Writes the bytes as rows of 16: the offset, the hexadecimal values and the printable
+ * characters (the others being written as dots). Every row starts with a new line.
+ * @tparam ITERATOR: The type of the output iterator.
+ * @param output: Where the rows are written.
+ * @param bytes: The bytes to be rendered.
+ * @returns The iterator past the last written character.
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+template<typename ITERATOR>
+ITERATOR render_hexdump(ITERATOR output, const std::span<const std::byte> bytes) noexcept(false)
+{
+	static constexpr std::size_t	  ROW_LENGTH		 = 16UL;
+	static constexpr std::string_view HEXADECIMAL_DIGITS = "0123456789abcdef";
+
+	for (std::size_t offset = 0UL; offset < bytes.size(); offset += ROW_LENGTH)
+	{
+		const std::span<const std::byte> row = bytes.subspan(offset, std::min(ROW_LENGTH, bytes.size() - offset));
+
+		output = std::format_to(output, "\n{:08x} ", offset);
+		for (std::size_t index = 0UL; index < ROW_LENGTH; ++index)
+		{
+			const std::uint8_t value = index < row.size() ? std::to_integer<std::uint8_t>(row[index]) : 0U;
+
+			*output++ = ' ';
+			if (ROW_LENGTH / 2UL == index)
+			{
+				*output++ = ' ';
+			}
+
+			*output++ = index < row.size() ? HEXADECIMAL_DIGITS[value >> 4U] : ' ';
+			*output++ = index < row.size() ? HEXADECIMAL_DIGITS[value & 0x0FU] : ' ';
+		}
+
+		output = std::ranges::copy(std::string_view{ "  |" }, output).out;
+		for (const std::byte byte : row)
+		{
+			const std::uint8_t value = std::to_integer<std::uint8_t>(byte);
+			*output++				 = 0x20U <= value && 0x7FU > value ? static_cast<char>(value) : '.';
+		}
+
+		*output++ = '|';
+	}
+
+	return output;
+}
+
+/** ***************************************************************************************************
+ * @brief Writes the bytes encoded as base64 (standard alphabet, padded).
+ * @tparam ITERATOR: The type of the output iterator.
+ * @param output: Where the encoding is written.
+ * @param bytes: The bytes to be rendered.
+ * @returns The iterator past the last written character.
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+template<typename ITERATOR>
+ITERATOR render_base64(ITERATOR output, const std::span<const std::byte> bytes) noexcept(false)
+{
+	static constexpr std::string_view ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	std::size_t	  index = 0UL;
+	std::uint32_t group = 0U;
+
+	for (; index + 3UL <= bytes.size(); index += 3UL)
+	{
+		group = std::to_integer<std::uint32_t>(bytes[index]) << 16U | std::to_integer<std::uint32_t>(bytes[index + 1UL]) << 8U
+			  | std::to_integer<std::uint32_t>(bytes[index + 2UL]);
+
+		*output++ = ALPHABET[group >> 18U & 0x3FU];
+		*output++ = ALPHABET[group >> 12U & 0x3FU];
+		*output++ = ALPHABET[group >> 6U & 0x3FU];
+		*output++ = ALPHABET[group & 0x3FU];
+	}
+
+	if (index == bytes.size())
+	{
+		return output;
+	}
+
+	group = std::to_integer<std::uint32_t>(bytes[index]) << 16U;
+	if (index + 1UL < bytes.size())
+	{
+		group |= std::to_integer<std::uint32_t>(bytes[index + 1UL]) << 8U;
+	}
+
+	*output++ = ALPHABET[group >> 18U & 0x3FU];
+	*output++ = ALPHABET[group >> 12U & 0x3FU];
+	*output++ = index + 1UL < bytes.size() ? ALPHABET[group >> 6U & 0x3FU] : '=';
+	*output++ = '=';
+
+	return output;
+}
+
+/** ***************************************************************************************************
+ * @brief Writes the blob according to its encoding, followed by the number of bytes that have been
+ * truncated (if any).
+ * @tparam ITERATOR: The type of the output iterator.
+ * @param output: Where the blob is written.
+ * @param blob: The blob to be rendered.
+ * @returns The iterator past the last written character.
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+template<typename ITERATOR>
+ITERATOR render_blob(ITERATOR output, const blob& blob) noexcept(false)
+{
+	if (blob_encoding::BASE64 == blob.encoding)
+	{
+		output = render_base64(output, blob.bytes);
+		return blob.length == blob.bytes.size() ? output : std::format_to(output, "... ({} more bytes)", blob.length - blob.bytes.size());
+	}
+
+	output = std::format_to(output, "{} bytes:", blob.length);
+	output = render_hexdump(output, blob.bytes);
+	return blob.length == blob.bytes.size() ? output : std::format_to(output, "\n... ({} more bytes)", blob.length - blob.bytes.size());
+}
+
+} /*< namespace hob::log::details */
+
+namespace std
+{
+
+/** ***************************************************************************************************
+ * @brief This class allows hob::log::blob to be formatted so it can be an argument of the logging
+ * macros (no format specification is supported).
+ *****************************************************************************************************/
+template<>
+class formatter<hob::log::blob>
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Checks that the replacement field has no format specification.
+	 * @param context: The format specification.
+	 * @returns The end of the format specification.
+	 * @throws std::format_error: If there is a format specification (a build error at compile time).
+	 *************************************************************************************************/
+	constexpr format_parse_context::iterator parse(format_parse_context& context) noexcept(false)
+	{
+		return context.begin() == context.end() || '}' == *context.begin() ? context.begin() : throw format_error{ "Blobs have no format specification!" };
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Renders the blob (@see hob::log::details::render_blob()).
+	 * @param blob: The blob to be rendered.
+	 * @param context: Provides access to formatting state consisting of the formatting arguments and
+	 * the output iterator.
+	 * @returns The iterator past the last written character.
+	 * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+	 *************************************************************************************************/
+	auto format(const hob::log::blob& blob, format_context& context) const noexcept(false)
+	{
+		return hob::log::details::render_blob(context.out(), blob);
+	}
+};
+
+} /*< namespace std */
+
+#endif /*< HOB_LOG_STRIP_ALL */
+
+#endif /*< HOB_LOG_DETAILS_BLOB_HPP_ */
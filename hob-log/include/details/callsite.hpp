@@ -0,0 +1,140 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file callsite.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the static description of a place in the code where a message is logged.
+ * @details Every logging macro expansion defines its own description, initialized at compile time, so
+ * everything that is known at compile time (including the file name) is computed once and only its
+ * address travels with the message. The address is stable for the lifetime of the program, identifying
+ * the call site. The mutable parts are the status of the call site, which is registered in a
+ * process-wide table the first time it is reached so it can be enabled or disabled at runtime, and
+ * its statistics, which are relaxed atomic counters.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_DETAILS_CALLSITE_HPP_
+#define HOB_LOG_DETAILS_CALLSITE_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_STRIP_ALL
+
+#include <string_view>
+#include <atomic>
+#include <cstdint>
+
+#include "visibility.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log::details
+{
+
+struct callsite;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Adds a call site to the process-wide table and decides its status based on the rules that
+ * have been set so far. It is thread-safe.
+ * @param callsite: The call site reached for the first time (needs to have static storage).
+ * @returns The status of the call site (see hob::log::details::callsite::status).
+ * @throws N/A.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern std::uint8_t register_callsite(const callsite& callsite) noexcept;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Everything about a logging macro expansion that is known at compile time, plus its status.
+ * @details The statistics start on their own cache line, so counting the messages of a hot call site
+ * does not invalidate the line its status is read from by every call.
+ *****************************************************************************************************/
+struct callsite final
+{
+	/** ***********************************************************************************************
+	 * @brief Enumerates the states of a call site.
+	 *************************************************************************************************/
+	enum status : std::uint8_t
+	{
+		UNREGISTERED = 0U, /**< The call site has not been reached yet. */
+		ENABLED		 = 1U, /**< The messages are being logged.			*/
+		DISABLED	 = 2U  /**< The messages are being dropped.		   */
+	};
+
+	std::uint8_t									severity_bit;			/**< Bit indicating the type of message that is being logged.		*/
+	std::string_view								tag;					/**< Tag indicating the type of message.							*/
+	std::string_view								file_path;				/**< The path of the file where the log function is being called.	*/
+	std::string_view								file_name;				/**< The file path without the directories.							*/
+	std::string_view								function_name;			/**< The name of the function where this call is made.				*/
+	std::int32_t									line;					/**< The line where the log function is being called.				*/
+	mutable std::atomic<std::uint8_t>				state;					/**< The status of the call site (see callsite::status).			*/
+	alignas(64) mutable std::atomic<std::uint64_t>	messages_count = 0UL;	/**< Messages sent to the sinks.									*/
+	mutable std::atomic<std::uint64_t>				bytes_count = 0UL;		/**< Bytes of the lines written by the sinks.						*/
+	mutable std::atomic<std::uint64_t>				filtered_count = 0UL;	/**< Messages filtered by the severity level of a sink.				*/
+	mutable std::atomic<std::uint64_t>				dropped_count = 0UL;	/**< Messages dropped by the limiter, collapsed or lost by a sink.	*/
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the messages of this call site are being logged. Once the call site has been
+	 * registered the check costs one relaxed atomic load. It is thread-safe.
+	 * @param void
+	 * @returns true - the call site is enabled.
+	 * @returns false - the call site is disabled.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_enabled(void) const noexcept
+	{
+		const std::uint8_t status = state.load(std::memory_order_relaxed);
+		return ENABLED == (UNREGISTERED == status ? register_callsite(*this) : status);
+	}
+};
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Removes the directories from a file path. It is meant to be evaluated at compile time.
+ * @param file_path: The path of the file.
+ * @returns The name of the file.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] constexpr std::string_view get_file_name(const std::string_view file_path) noexcept
+{
+	const std::size_t separator = file_path.rfind('/');
+	return std::string_view::npos == separator ? file_path : file_path.substr(separator + 1UL);
+}
+
+} /*< namespace hob::log::details */
+
+#endif /*< HOB_LOG_STRIP_ALL */
+
+#endif /*< HOB_LOG_DETAILS_CALLSITE_HPP_ */
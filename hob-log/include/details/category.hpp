@@ -0,0 +1,120 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file category.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the hierarchical categories the messages can be logged under.
+ * @details A category is named by its path (e.g. "engine.net.lockstep") and inherits the severity
+ * level and the sink from its parent unless they are overridden. The inherited values are resolved
+ * eagerly every time the configuration of a category changes, so the logging path only loads the
+ * precomputed values through the handle of the category, no name being looked up. The routing table
+ * of a category maps every severity to the set of sinks (a bitset of their indices) the message is
+ * sent to, so the sinks that would filter the message are never visited.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_DETAILS_CATEGORY_HPP_
+#define HOB_LOG_DETAILS_CATEGORY_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_STRIP_ALL
+
+#include <atomic>
+#include <array>
+#include <string_view>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+namespace details
+{
+
+/** ***************************************************************************************************
+ * @brief The number of severities (@see hob::log::severity_level).
+ *****************************************************************************************************/
+inline constexpr std::size_t SEVERITY_COUNT = 6UL;
+
+/** ***************************************************************************************************
+ * @brief How many sinks can be routed to through the categories (the width of the sink bitsets).
+ *****************************************************************************************************/
+inline constexpr std::size_t MAXIMUM_ROUTED_SINKS = 64UL;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The resolved configuration of a category (its own values or the inherited ones). It is owned
+ * by the logger and lives until the end of the program.
+ *****************************************************************************************************/
+struct category final
+{
+	/** ***********************************************************************************************
+	 * @brief The path of the category (e.g. "engine.net.lockstep").
+	 *************************************************************************************************/
+	std::string_view name;
+
+	/** ***********************************************************************************************
+	 * @brief Bitmask of the severities logged under the category (0 if it is not routed to a sink).
+	 *************************************************************************************************/
+	std::atomic<std::uint8_t> effective_level;
+
+	/** ***********************************************************************************************
+	 * @brief For every severity (indexed by the position of its bit) the bitset of the indices of the
+	 * sinks the messages are sent to. Only the sinks that accept the severity are in it.
+	 *************************************************************************************************/
+	std::array<std::atomic<std::uint64_t>, SEVERITY_COUNT> routes;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the sinks the messages of a severity are sent to. It is thread-safe.
+	 * @param severity_bit: The bit of the severity (see hob::log::severity_level).
+	 * @returns The bitset of the indices of the sinks.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::uint64_t get_routes(const std::uint8_t severity_bit) const noexcept
+	{
+		return routes[std::countr_zero(severity_bit)].load(std::memory_order_acquire);
+	}
+};
+
+} /*< namespace details */
+
+/** ***************************************************************************************************
+ * @brief Handle of a category (@see get_category()). It stays valid until the end of the program.
+ *****************************************************************************************************/
+using category_handle = const details::category*;
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_STRIP_ALL */
+
+#endif /*< HOB_LOG_DETAILS_CATEGORY_HPP_ */
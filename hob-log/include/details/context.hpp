@@ -0,0 +1,172 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file context.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the mapped diagnostic context: key-value fields pushed by a thread that
+ * are attached to every message it logs (e.g. the identifier of the match being played).
+ * @details Every thread has its own context, a stack of fields that are rendered once, when they are
+ * pushed, both as text ("key=value" pairs separated by spaces) and encoded (@see fields.hpp) for
+ * the structured sinks. A message only views the two renderings, so logging it costs copying one
+ * span of each, the values not being formatted again.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_DETAILS_CONTEXT_HPP_
+#define HOB_LOG_DETAILS_CONTEXT_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_STRIP_ALL
+
+#include <string>
+#include <format>
+#include <iterator>
+#include <cstddef>
+
+#include "visibility.hpp"
+#include "fields.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+namespace details
+{
+
+/** ***************************************************************************************************
+ * @brief The context of a thread, the fields being appended to both renderings in the order they
+ * have been pushed.
+ *****************************************************************************************************/
+struct context final
+{
+	std::string text;	/**< The fields as "key=value" pairs separated by spaces.	*/
+	std::string fields; /**< The encoded fields (@see fields.hpp).				*/
+};
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gets the context of the calling thread.
+ * @param void
+ * @returns Reference to the context of the calling thread.
+ * @throws N/A.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern context& get_context(void) noexcept;
+
+} /*< namespace details */
+
+/** ***************************************************************************************************
+ * @brief Pushes a field to the context of the calling thread for as long as the object lives. Every
+ * message logged by the thread meanwhile carries it, through the {CONTEXT} placeholder and the
+ * "context" object of the structured sinks (e.g. `hob::log::scoped_context match{ "match", id };`).
+ * The objects need to be destroyed in the reverse order of their creation, which holds for local
+ * variables. The logger does not need to be initialized.
+ *****************************************************************************************************/
+class scoped_context final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Renders the field and pushes it to the context of the calling thread.
+	 * @tparam TYPE: The type of the value (a boolean, a number or a string).
+	 * @param key: The name of the field.
+	 * @param value: The value of the field.
+	 * @throws std::bad_alloc: If the context needs to grow and the memory reallocation fails (the
+	 * context is left as it was).
+	 *************************************************************************************************/
+	template<typename TYPE>
+	scoped_context(std::string_view key, const TYPE& value) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Pops the field from the context of the calling thread.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	~scoped_context(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief The field belongs to the scope it has been pushed in.
+	 *************************************************************************************************/
+	scoped_context(const scoped_context&)			 = delete;
+	scoped_context& operator=(const scoped_context&) = delete;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The length of the text rendering before the field has been pushed.
+	 *************************************************************************************************/
+	std::size_t text_length;
+
+	/** ***********************************************************************************************
+	 * @brief The length of the encoded fields before the field has been pushed.
+	 *************************************************************************************************/
+	std::size_t fields_length;
+};
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+template<typename TYPE>
+scoped_context::scoped_context(const std::string_view key, const TYPE& value) noexcept(false)
+	: text_length{ details::get_context().text.length() }
+	, fields_length{ details::get_context().fields.length() }
+{
+	details::context& context = details::get_context();
+
+	try
+	{
+		if (0UL != text_length)
+		{
+			context.text.push_back(' ');
+		}
+
+		(void)std::format_to(std::back_inserter(context.text), "{}={}", key, value);
+		details::serialize_field(context.fields, key, value);
+	}
+	catch (...)
+	{
+		context.text.resize(text_length);
+		context.fields.resize(fields_length);
+		throw;
+	}
+}
+
+inline scoped_context::~scoped_context(void) noexcept
+{
+	details::context& context = details::get_context();
+
+	context.text.resize(text_length);
+	context.fields.resize(fields_length);
+}
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_STRIP_ALL */
+
+#endif /*< HOB_LOG_DETAILS_CONTEXT_HPP_ */
@@ -0,0 +1,246 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file fields.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the binary encoding of the key-value fields of a structured log.
+ * @details Every field is encoded as the length and the characters of its key, followed by the index
+ * of the type of its value (@see field_value) and the value itself (strings as their length followed
+ * by their characters). The encoding describes itself, so the fields can be decoded without knowing
+ * the types they have been logged with.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_DETAILS_FIELDS_HPP_
+#define HOB_LOG_DETAILS_FIELDS_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_STRIP_ALL
+
+#include <string>
+#include <variant>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+#include "arguments.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log::details
+{
+
+/** ***************************************************************************************************
+ * @brief The value of a field, the index of the alternative being the one that is encoded.
+ *****************************************************************************************************/
+using field_value = std::variant<bool, std::int64_t, std::uint64_t, double, std::string_view>;
+
+/** ***************************************************************************************************
+ * @brief A decoded field (the key and the strings are viewed inside the encoded fields).
+ *****************************************************************************************************/
+struct field final
+{
+	std::string_view key;	/**< The name of the field.  */
+	field_value		 value; /**< The value of the field. */
+};
+
+/** ***************************************************************************************************
+ * @brief The type a field value is being encoded as (void if it can not be encoded).
+ *****************************************************************************************************/
+template<typename TYPE>
+using encoded_field_t = std::conditional_t<
+	std::is_same_v<bool, std::decay_t<TYPE>>,
+	bool,
+	std::conditional_t<is_string_argument_v<TYPE>,
+					   std::string_view,
+					   std::conditional_t<std::is_floating_point_v<std::decay_t<TYPE>>,
+										  double,
+										  std::conditional_t<std::is_integral_v<std::decay_t<TYPE>>,
+															 std::conditional_t<std::is_signed_v<std::decay_t<TYPE>>, std::int64_t, std::uint64_t>,
+															 void>>>>;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Appends a string to the destination as its length followed by its characters.
+ * @param destination: The string the encoding will be appended to.
+ * @param string: The string to be encoded.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+inline void serialize_string(std::string& destination, const std::string_view string) noexcept(false)
+{
+	const std::size_t length = string.length();
+
+	(void)destination.append(reinterpret_cast<const char*>(&length), sizeof(length));
+	(void)destination.append(string);
+}
+
+/** ***************************************************************************************************
+ * @brief Appends the encoding of a field to the destination.
+ * @tparam TYPE: The type of the value (a boolean, a number or a string).
+ * @param destination: The string the encoding will be appended to.
+ * @param key: The name of the field.
+ * @param value: The value of the field.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+template<typename TYPE>
+void serialize_field(std::string& destination, const std::string_view key, const TYPE& value) noexcept(false)
+{
+	using encoded_type = encoded_field_t<TYPE>;
+
+	static_assert(false == std::is_void_v<encoded_type>, "The value of a field needs to be a boolean, a number or a string!");
+
+	const std::uint8_t index = static_cast<std::uint8_t>(field_value{ std::in_place_type<encoded_type> }.index());
+
+	serialize_string(destination, key);
+	destination.push_back(static_cast<char>(index));
+
+	if constexpr (true == std::is_same_v<std::string_view, encoded_type>)
+	{
+		serialize_string(destination, value);
+	}
+	else
+	{
+		const encoded_type encoded_value = static_cast<encoded_type>(value);
+		(void)destination.append(reinterpret_cast<const char*>(&encoded_value), sizeof(encoded_value));
+	}
+}
+
+/** ***************************************************************************************************
+ * @brief Appends the encoding of the fields to the destination.
+ * @tparam KEY: The type of the first key (convertible to std::string_view).
+ * @tparam VALUE: The type of the first value.
+ * @tparam args: The types of the remaining keys and values, alternating.
+ * @param destination: The string the encoding will be appended to.
+ * @param key: The name of the first field.
+ * @param value: The value of the first field.
+ * @param fields: The remaining keys and values, alternating.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+template<typename KEY, typename VALUE, typename... args>
+void serialize_fields(std::string& destination, const KEY& key, const VALUE& value, const args&... fields) noexcept(false)
+{
+	serialize_field(destination, key, value);
+
+	if constexpr (0UL != sizeof...(args))
+	{
+		serialize_fields(destination, fields...);
+	}
+}
+
+/** ***************************************************************************************************
+ * @brief Decodes the string at the beginning of the encoding and removes it.
+ * @param fields: The remaining encoded fields.
+ * @returns The decoded string.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] inline std::string_view deserialize_string(std::string_view& fields) noexcept
+{
+	std::size_t length = 0UL;
+
+	(void)std::memcpy(&length, fields.data(), sizeof(length));
+	fields.remove_prefix(sizeof(length));
+
+	const std::string_view string = fields.substr(0UL, length);
+	fields.remove_prefix(length);
+
+	return string;
+}
+
+/** ***************************************************************************************************
+ * @brief Decodes a number at the beginning of the encoding and removes it.
+ * @tparam TYPE: The type of the number.
+ * @param fields: The remaining encoded fields.
+ * @returns The decoded number.
+ * @throws N/A.
+ *****************************************************************************************************/
+template<typename TYPE>
+[[nodiscard]] TYPE deserialize_number(std::string_view& fields) noexcept
+{
+	TYPE value = {};
+
+	(void)std::memcpy(&value, fields.data(), sizeof(value));
+	fields.remove_prefix(sizeof(value));
+
+	return value;
+}
+
+/** ***************************************************************************************************
+ * @brief Decodes the field at the beginning of the encoded fields and removes it.
+ * @param fields: The remaining encoded fields (can not be empty).
+ * @returns The decoded field.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] inline field deserialize_field(std::string_view& fields) noexcept
+{
+	field field = { deserialize_string(fields), false };
+
+	const std::uint8_t index = static_cast<std::uint8_t>(fields.front());
+	fields.remove_prefix(1UL);
+
+	switch (index)
+	{
+		case 0U:
+		{
+			field.value = 0 != deserialize_number<std::uint8_t>(fields);
+			break;
+		}
+		case 1U:
+		{
+			field.value = deserialize_number<std::int64_t>(fields);
+			break;
+		}
+		case 2U:
+		{
+			field.value = deserialize_number<std::uint64_t>(fields);
+			break;
+		}
+		case 3U:
+		{
+			field.value = deserialize_number<double>(fields);
+			break;
+		}
+		default:
+		{
+			field.value = deserialize_string(fields);
+			break;
+		}
+	}
+
+	return field;
+}
+
+} /*< namespace hob::log::details */
+
+#endif /*< HOB_LOG_STRIP_ALL */
+
+#endif /*< HOB_LOG_DETAILS_FIELDS_HPP_ */
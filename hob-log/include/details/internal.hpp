@@ -24,10 +24,19 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <string>
 #include <format>
+#include <atomic>
+#include <iterator>
 
 #include "../types.hpp"
 #include "../configuration.hpp"
+#include "arguments.hpp"
+#include "callsite.hpp"
+#include "limiter.hpp"
+#include "fields.hpp"
+#include "category.hpp"
+#include "context.hpp"
 
 /******************************************************************************************************
  * MACROS
@@ -35,9 +44,127 @@
 
 #ifndef HOB_LOG_STRIP_ALL
 
-// TOOD: documentation
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be called outside hob-log macros. If no sink accepts the severity
+ * the call costs a single load and branch, the sink name and the arguments not being evaluated. The
+ * call site is described by a variable that is initialized at compile time, only its address being
+ * passed along. If the call site has been disabled at runtime the call costs one more load.
+ * @param sink_name: The name of the name the message will be sent to.
+ * @param severity_bit: Bit indicating the type of message that is being logged (see
+ * hob::log::severity_level).
+ * @param tag: Tag indicating the type of message.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
 #define HOB_LOG_DETAILS(sink_name, severity_bit, tag, format, ...)                                                                                                 \
-	hob::log::details::log(sink_name, severity_bit, tag, __FILE__, __FUNCTION__, __LINE__, format, ##__VA_ARGS__)
+	do                                                                                                                                                             \
+	{                                                                                                                                                              \
+		if (0U != ((severity_bit) & hob::log::details::severity_mask.load(std::memory_order_relaxed)))                                                             \
+		{                                                                                                                                                          \
+			static constinit hob::log::details::callsite hob_log_callsite = {                                                                                      \
+				severity_bit, tag, __FILE__, hob::log::details::get_file_name(__FILE__), __FUNCTION__, __LINE__, 0U                                                \
+			};                                                                                                                                                     \
+			if (true == hob_log_callsite.is_enabled())                                                                                                             \
+			{                                                                                                                                                      \
+				hob::log::details::log(sink_name, &hob_log_callsite, 0UL, format, ##__VA_ARGS__);                                                                  \
+			}                                                                                                                                                      \
+		}                                                                                                                                                          \
+	}                                                                                                                                                              \
+	while (false)
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be called outside hob-log macros. It is HOB_LOG_DETAILS() with a
+ * per call site limiter (see limiter.hpp) deciding which calls are being logged. The dropped calls
+ * return before the arguments are evaluated, their count being reported in the next logged message.
+ * @param sink_name: The name of the name the message will be sent to.
+ * @param severity_bit: Bit indicating the type of message that is being logged (see
+ * hob::log::severity_level).
+ * @param tag: Tag indicating the type of message.
+ * @param limiter_type: The name of the limiter class (e.g. every_n).
+ * @param limit: The parenthesized arguments of the should_log() method of the limiter.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DETAILS_LIMITED(sink_name, severity_bit, tag, limiter_type, limit, format, ...)                                                                    \
+	do                                                                                                                                                             \
+	{                                                                                                                                                              \
+		if (0U != ((severity_bit) & hob::log::details::severity_mask.load(std::memory_order_relaxed)))                                                             \
+		{                                                                                                                                                          \
+			static constinit hob::log::details::callsite hob_log_callsite = {                                                                                      \
+				severity_bit, tag, __FILE__, hob::log::details::get_file_name(__FILE__), __FUNCTION__, __LINE__, 0U                                                \
+			};                                                                                                                                                     \
+			static constinit hob::log::details::limiter_type hob_log_limiter = {};                                                                                 \
+			if (true == hob_log_callsite.is_enabled() && true == hob_log_limiter.should_log limit)                                                                 \
+			{                                                                                                                                                      \
+				hob::log::details::log(sink_name, &hob_log_callsite, hob_log_limiter.take_suppressed_count(), format, ##__VA_ARGS__);                              \
+			}                                                                                                                                                      \
+		}                                                                                                                                                          \
+	}                                                                                                                                                              \
+	while (false)
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be called outside hob-log macros. It is HOB_LOG_DETAILS() for
+ * structured messages: the message is not formatted, the key-value fields being encoded (see
+ * fields.hpp) so every sink can render them its own way.
+ * @param sink_name: The name of the name the message will be sent to.
+ * @param severity_bit: Bit indicating the type of message that is being logged (see
+ * hob::log::severity_level).
+ * @param tag: Tag indicating the type of message.
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The keys and the values of the fields, alternating (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DETAILS_FIELDS(sink_name, severity_bit, tag, message, ...)                                                                                         \
+	do                                                                                                                                                             \
+	{                                                                                                                                                              \
+		if (0U != ((severity_bit) & hob::log::details::severity_mask.load(std::memory_order_relaxed)))                                                             \
+		{                                                                                                                                                          \
+			static constinit hob::log::details::callsite hob_log_callsite = {                                                                                      \
+				severity_bit, tag, __FILE__, hob::log::details::get_file_name(__FILE__), __FUNCTION__, __LINE__, 0U                                                \
+			};                                                                                                                                                     \
+			if (true == hob_log_callsite.is_enabled())                                                                                                             \
+			{                                                                                                                                                      \
+				hob::log::details::log_fields(sink_name, &hob_log_callsite, message, ##__VA_ARGS__);                                                               \
+			}                                                                                                                                                      \
+		}                                                                                                                                                          \
+	}                                                                                                                                                              \
+	while (false)
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be called outside hob-log macros. It is HOB_LOG_DETAILS() for a
+ * category: the check is a single load of the severity level resolved for the category (see
+ * category.hpp), the message being sent only to the sinks of the routing table of the category, so
+ * the sinks that would filter it are not visited.
+ * @param category: The handle of the category (see hob::log::get_category()).
+ * @param severity_bit: Bit indicating the type of message that is being logged (see
+ * hob::log::severity_level).
+ * @param tag: Tag indicating the type of message.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DETAILS_CATEGORY(category, severity_bit, tag, format, ...)                                                                                         \
+	do                                                                                                                                                             \
+	{                                                                                                                                                              \
+		const hob::log::category_handle hob_log_category = (category);                                                                                             \
+		if (0U != ((severity_bit) & hob_log_category->effective_level.load(std::memory_order_relaxed)))                                                            \
+		{                                                                                                                                                          \
+			static constinit hob::log::details::callsite hob_log_callsite = {                                                                                      \
+				severity_bit, tag, __FILE__, hob::log::details::get_file_name(__FILE__), __FUNCTION__, __LINE__, 0U                                                \
+			};                                                                                                                                                     \
+			if (true == hob_log_callsite.is_enabled())                                                                                                             \
+			{                                                                                                                                                      \
+				hob::log::details::log(hob_log_category, &hob_log_callsite, 0UL, format, ##__VA_ARGS__);                                                           \
+			}                                                                                                                                                      \
+		}                                                                                                                                                          \
+	}                                                                                                                                                              \
+	while (false)
 
 #endif /*< HOB_LOG_STRIP_ALL */
 
@@ -126,7 +253,7 @@
 #endif /*< HOB_LOG_STRIP_TRACE */
 
 /******************************************************************************************************
- * FUNCTION PROTOTYPES
+ * GLOBAL VARIABLES
  *****************************************************************************************************/
 
 #ifndef HOB_LOG_STRIP_ALL
@@ -134,71 +261,179 @@
 namespace hob::log::details
 {
 
+/** ***************************************************************************************************
+ * @brief Bitmask of the severities accepted by at least one sink (the union of all severity levels).
+ * It is kept up to date when sinks are added, removed or their severity level is changed.
+ *****************************************************************************************************/
+HOB_LOG_API extern std::atomic<std::uint8_t> severity_mask;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
 /** ***************************************************************************************************
  * @brief This function is not meant to be called outside hob-log macros.
- * @tparam: Variadic parameters to format.
- * @param sink_name: The name of the name the message will be sent to.
- * @param severity_bit: Bit indicating the type of message that is being logged (see
- * hob::log::severity_level).
- * @param tag: Tag indicating the type of message.
- * @param file_path: The path of the file where the log function is being called.
- * @param function_name: The name of the function where this call is made.
- * @param line: The line where the log function is being called.
- * @param format: String that contains the text to be written.
+ * @tparam: The type of the destination, followed by the variadic parameters to format.
+ * @param destination: The name of the sink the message will be sent to or the handle of the category
+ * it is logged under (see category.hpp).
+ * @param callsite: The description of the place where the message has been logged (needs to have
+ * static storage).
+ * @param suppressed_count: The number of calls of this call site that have been dropped by its
+ * limiter since the previous logged one.
+ * @param format: String that contains the text to be written. It is parsed and checked against the
+ * arguments at compile time, a mismatch being a build error. If there are no arguments and it
+ * contains no braces it is sent as it is, without being formatted. If all the arguments can be
+ * encoded (see arguments.hpp) the formatting is deferred to the sink, otherwise the message is
+ * formatted on the calling thread.
  * @param args: Arguments to be formatted.
  * @returns void
  * @throws N/A.
  *****************************************************************************************************/
-template<typename... args>
+template<typename destination_type, typename... args>
 HOB_LOG_API extern void
-log(std::string_view sink_name,
-	std::uint8_t	 severity_bit,
-	std::string_view tag,
-	std::string_view file_path,
-	std::string_view function_name,
-	std::int32_t	 line,
-	std::string_view format,
-	args&&... arguments) noexcept;
+log(destination_type destination, const callsite* callsite, std::uint64_t suppressed_count, std::format_string<args...> format, args&&... arguments) noexcept;
+
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside hob-log macros.
+ * @tparam: The types of the keys and the values of the fields, alternating.
+ * @param sink_name: The name of the name the message will be sent to.
+ * @param callsite: The description of the place where the message has been logged (needs to have
+ * static storage).
+ * @param message: String that contains the text to be written.
+ * @param fields: The keys (convertible to std::string_view) and the values (booleans, numbers or
+ * strings) of the fields, alternating. A missing value is a build error.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+template<typename... args>
+HOB_LOG_API extern void log_fields(std::string_view sink_name, const callsite* callsite, std::string_view message, const args&... fields) noexcept;
 
 /** ***********************************************************************************************
  * @brief Sends a message to the appropiate sink for it to handle.
  * @param sink_name: The name of the name the message will be sent to.
- * @param severity_bit: Bit indicating the type of message that is being logged (see
- * hob::log::severity_level).
- * @param tag: Tag indicating the type of message.
- * @param file_path: The path of the file where the log function is being called.
- * @param function_name: The name of the function where this call is made.
- * @param line: The line where the log function is being called.
- * @param message: The message to be logged.
+ * @param callsite: The description of the place where the message has been logged (needs to have
+ * static storage).
+ * @param suppressed_count: The number of calls of this call site that have been dropped by its
+ * limiter since the previous logged one.
+ * @param format: String that contains the text to be written (needs to have static storage).
+ * @param decode: The function formatting the encoded arguments (nullptr if the message has already
+ * been formatted).
+ * @param arguments: The encoded arguments (see arguments.hpp) or the message if it has already been
+ * formatted.
  * @returns void
  * @throws N/A.
  *************************************************************************************************/
-HOB_LOG_API extern void
-log(std::string_view sink_name,
-	std::uint8_t	 severity_bit,
-	std::string_view tag,
-	std::string_view file_path,
-	std::string_view function_name,
-	std::int32_t	 line,
-	std::string_view message) noexcept;
+HOB_LOG_API extern void log_message(std::string_view sink_name,
+									const callsite*	 callsite,
+									std::uint64_t	 suppressed_count,
+									std::string_view format,
+									decoder			 decode,
+									std::string_view arguments) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Sends a message to the sinks the routing table of a category has for its severity,
+ * iterating the bitset once.
+ * @param category: The handle of the category the message is logged under.
+ * @param callsite: The description of the place where the message has been logged (needs to have
+ * static storage).
+ * @param suppressed_count: The number of calls of this call site that have been dropped by its
+ * limiter since the previous logged one.
+ * @param format: String that contains the text to be written (needs to have static storage).
+ * @param decode: The function formatting the encoded arguments (nullptr if the message has already
+ * been formatted).
+ * @param arguments: The encoded arguments (see arguments.hpp) or the message if it has already been
+ * formatted.
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_API extern void log_message(category_handle	 category,
+									const callsite*	 callsite,
+									std::uint64_t	 suppressed_count,
+									std::string_view format,
+									decoder			 decode,
+									std::string_view arguments) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Sends a structured message to the appropiate sink for it to handle.
+ * @param sink_name: The name of the name the message will be sent to.
+ * @param callsite: The description of the place where the message has been logged (needs to have
+ * static storage).
+ * @param message: String that contains the text to be written.
+ * @param fields: The encoded fields (see fields.hpp).
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_API extern void log_fields_message(std::string_view sink_name, const callsite* callsite, std::string_view message, std::string_view fields) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Gets the buffer the user message is encoded (or formatted) into before being sent to the
+ * sinks. Every thread has its own buffer whose capacity is kept between calls, so in steady state
+ * logging a message does not allocate memory.
+ * @param void
+ * @returns Reference to the buffer of the calling thread.
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern std::string& get_message_buffer(void) noexcept;
 
 /******************************************************************************************************
  * FUNCTION DEFINITIONS
  *****************************************************************************************************/
 
-template<typename... args>
-void log(std::string_view		sink_name,
-		 const std::uint8_t		severity_bit,
-		 const std::string_view tag,
-		 const std::string_view file_path,
-		 const std::string_view function_name,
-		 const std::int32_t		line,
-		 const std::string_view format,
+template<typename destination_type, typename... args>
+void log(const destination_type			   destination,
+		 const callsite* const			   callsite,
+		 const std::uint64_t			   suppressed_count,
+		 const std::format_string<args...> format,
 		 args&&... arguments) noexcept
 {
+	std::string& message = get_message_buffer();
+
+	if constexpr (0UL == sizeof...(args))
+	{
+		if (std::string_view::npos == format.get().find_first_of("{}"))
+		{
+			log_message(destination, callsite, suppressed_count, format.get(), nullptr, format.get());
+			return;
+		}
+	}
+
 	try
 	{
-		log(sink_name, severity_bit, tag, file_path, function_name, line, std::vformat(format, std::make_format_args(std::forward<args>(arguments)...)));
+		message.clear();
+
+		if constexpr (((true == is_serializable_v<args>) && ...))
+		{
+			(serialize_argument(message, arguments), ...);
+			log_message(destination, callsite, suppressed_count, format.get(), &deserialize<args...>, message);
+		}
+		else
+		{
+			(void)std::format_to(std::back_inserter(message), format, std::forward<args>(arguments)...);
+			log_message(destination, callsite, suppressed_count, format.get(), nullptr, message);
+		}
+	}
+	catch (const std::exception& exception)
+	{
+	}
+}
+
+template<typename... args>
+void log_fields(const std::string_view sink_name, const callsite* const callsite, const std::string_view message, const args&... fields) noexcept
+{
+	static_assert(0UL == sizeof...(args) % 2UL, "Every key of a field needs to be followed by its value!");
+
+	std::string& encoded_fields = get_message_buffer();
+
+	try
+	{
+		encoded_fields.clear();
+
+		if constexpr (0UL != sizeof...(args))
+		{
+			serialize_fields(encoded_fields, fields...);
+		}
+
+		log_fields_message(sink_name, callsite, message, encoded_fields);
 	}
 	catch (const std::exception& exception)
 	{
@@ -0,0 +1,237 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file limiter.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the per call site state of the rate limited and sampled logging macros.
+ * @details Every limited macro expansion has its own state, initialized at compile time and updated
+ * only through atomic operations (no lock is taken). The calls that are dropped return before anything
+ * is formatted or copied, only being counted so the next logged message can report them.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_DETAILS_LIMITER_HPP_
+#define HOB_LOG_DETAILS_LIMITER_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_STRIP_ALL
+
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log::details
+{
+
+/** ***************************************************************************************************
+ * @brief Counts the dropped calls of a call site until the next one is being logged.
+ *****************************************************************************************************/
+class limiter
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Gets the number of calls that have been dropped since the previous logged one and resets
+	 * it. It is thread-safe.
+	 * @param void
+	 * @returns The number of dropped calls.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::uint64_t take_suppressed_count(void) noexcept
+	{
+		return 0UL == suppressed_count.load(std::memory_order_relaxed) ? 0UL : suppressed_count.exchange(0UL, std::memory_order_relaxed);
+	}
+
+protected:
+	/** ***********************************************************************************************
+	 * @brief Counts a dropped call. It is thread-safe.
+	 * @param void
+	 * @returns false - the call is not being logged.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool suppress(void) noexcept
+	{
+		(void)suppressed_count.fetch_add(1UL, std::memory_order_relaxed);
+		return false;
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Reads the monotonic clock the time based limiters are measured with. It is thread-safe.
+	 * @param void
+	 * @returns Nanoseconds since an unspecified point.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] static std::int64_t now(void) noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The number of calls that have been dropped since the previous logged one.
+	 *************************************************************************************************/
+	std::atomic<std::uint64_t> suppressed_count = 0UL;
+};
+
+/** ***************************************************************************************************
+ * @brief Logs one call out of every n.
+ *****************************************************************************************************/
+class every_n final : public limiter
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Decides if the current call is logged. It is thread-safe.
+	 * @param n: The sampling period (0 is treated as 1).
+	 * @returns true - the call is being logged.
+	 * @returns false - the call is being dropped.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool should_log(const std::uint64_t n) noexcept
+	{
+		return 1UL >= n || 0UL == calls_count.fetch_add(1UL, std::memory_order_relaxed) % n ? true : suppress();
+	}
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The number of times the call site has been reached.
+	 *************************************************************************************************/
+	std::atomic<std::uint64_t> calls_count = 0UL;
+};
+
+/** ***************************************************************************************************
+ * @brief Logs only the first n calls (the later ones are never reported since nothing follows them).
+ *****************************************************************************************************/
+class first_n final : public limiter
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Decides if the current call is logged. Once the limit has been reached the check is a
+	 * single relaxed atomic load. It is thread-safe.
+	 * @param n: The number of calls to be logged.
+	 * @returns true - the call is being logged.
+	 * @returns false - the call is being dropped.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool should_log(const std::uint64_t n) noexcept
+	{
+		return n > calls_count.load(std::memory_order_relaxed) && n > calls_count.fetch_add(1UL, std::memory_order_relaxed);
+	}
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The number of times the call site has been reached (it stops being counted at the limit).
+	 *************************************************************************************************/
+	std::atomic<std::uint64_t> calls_count = 0UL;
+};
+
+/** ***************************************************************************************************
+ * @brief Logs at most one call per time interval.
+ *****************************************************************************************************/
+class every_interval final : public limiter
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Decides if the current call is logged. It is thread-safe.
+	 * @param milliseconds: The length of the interval.
+	 * @returns true - the call is being logged.
+	 * @returns false - the call is being dropped.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool should_log(const std::int64_t milliseconds) noexcept
+	{
+		const std::int64_t current_time = now();
+		std::int64_t	   next_time	= next_log_time.load(std::memory_order_relaxed);
+
+		return current_time >= next_time
+					&& true == next_log_time.compare_exchange_strong(next_time, current_time + milliseconds * 1'000'000L, std::memory_order_relaxed)
+				 ? true
+				 : suppress();
+	}
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The moment from which the next call is being logged (in nanoseconds).
+	 *************************************************************************************************/
+	std::atomic<std::int64_t> next_log_time = 0L;
+};
+
+/** ***************************************************************************************************
+ * @brief Logs the calls as long as tokens are available, the bucket being refilled at a constant
+ * rate. It is implemented as the generic cell rate algorithm, so the whole bucket is a single atomic
+ * (the theoretical arrival time of the next call).
+ *****************************************************************************************************/
+class token_bucket final : public limiter
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Decides if the current call is logged (consuming a token). It is thread-safe.
+	 * @param rate: The number of tokens added every second (0 drops every call).
+	 * @param burst: The capacity of the bucket (0 is treated as 1).
+	 * @returns true - the call is being logged.
+	 * @returns false - the call is being dropped.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool should_log(const std::uint32_t rate, const std::uint32_t burst) noexcept
+	{
+		const std::int64_t current_time		= now();
+		const std::int64_t emission_interval = 0U == rate ? 0L : 1'000'000'000L / static_cast<std::int64_t>(rate);
+		const std::int64_t tolerance		= emission_interval * static_cast<std::int64_t>(std::max(burst, 1U));
+		std::int64_t	   arrival_time		= theoretical_arrival_time.load(std::memory_order_relaxed);
+		std::int64_t	   next_arrival_time = 0L;
+
+		if (0U == rate)
+		{
+			return suppress();
+		}
+
+		do
+		{
+			next_arrival_time = std::max(arrival_time, current_time) + emission_interval;
+			if (tolerance < next_arrival_time - current_time)
+			{
+				return suppress();
+			}
+		}
+		while (false == theoretical_arrival_time.compare_exchange_weak(arrival_time, next_arrival_time, std::memory_order_relaxed));
+
+		return true;
+	}
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The moment when the bucket will be full again (in nanoseconds).
+	 *************************************************************************************************/
+	std::atomic<std::int64_t> theoretical_arrival_time = 0L;
+};
+
+} /*< namespace hob::log::details */
+
+#endif /*< HOB_LOG_STRIP_ALL */
+
+#endif /*< HOB_LOG_DETAILS_LIMITER_HPP_ */
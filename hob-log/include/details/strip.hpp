@@ -85,6 +85,71 @@
  *****************************************************************************************************/
 #define HOB_LOG_FATAL(sink_name, format, ...) (void)0
 
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_EVERY_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_FIRST_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param milliseconds: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_EVERY_MS(sink_name, milliseconds, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param rate: Does not matter.
+ * @param burst: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_TOKEN_BUCKET(sink_name, rate, burst, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_KV(sink_name, message, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param category: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_CATEGORY(category, format, ...) (void)0
+
 #endif /*< HOB_LOG_STRIP_FATAL */
 
 #ifdef HOB_LOG_STRIP_ERROR
@@ -99,6 +164,71 @@
  *****************************************************************************************************/
 #define HOB_LOG_ERROR(sink_name, format, ...) (void)0
 
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_EVERY_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_FIRST_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param milliseconds: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_EVERY_MS(sink_name, milliseconds, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param rate: Does not matter.
+ * @param burst: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_TOKEN_BUCKET(sink_name, rate, burst, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_KV(sink_name, message, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param category: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_CATEGORY(category, format, ...) (void)0
+
 #endif /*< HOB_LOG_STRIP_ERROR */
 
 #ifdef HOB_LOG_STRIP_WARN
@@ -113,6 +243,71 @@
  *****************************************************************************************************/
 #define HOB_LOG_WARN(sink_name, format, ...) (void)0
 
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_EVERY_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_FIRST_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param milliseconds: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_EVERY_MS(sink_name, milliseconds, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param rate: Does not matter.
+ * @param burst: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_TOKEN_BUCKET(sink_name, rate, burst, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_KV(sink_name, message, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param category: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_CATEGORY(category, format, ...) (void)0
+
 #endif /*< HOB_LOG_STRIP_WARN */
 
 #ifdef HOB_LOG_STRIP_INFO
@@ -127,6 +322,71 @@
  *****************************************************************************************************/
 #define HOB_LOG_INFO(sink_name, format, ...) (void)0
 
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_EVERY_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_FIRST_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param milliseconds: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_EVERY_MS(sink_name, milliseconds, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param rate: Does not matter.
+ * @param burst: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_TOKEN_BUCKET(sink_name, rate, burst, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_KV(sink_name, message, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param category: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_CATEGORY(category, format, ...) (void)0
+
 #endif /*< HOB_LOG_STRIP_INFO */
 
 #ifdef HOB_LOG_STRIP_DEBUG
@@ -141,6 +401,71 @@
  *****************************************************************************************************/
 #define HOB_LOG_DEBUG(sink_name, format, ...) (void)0
 
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_EVERY_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_FIRST_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param milliseconds: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_EVERY_MS(sink_name, milliseconds, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param rate: Does not matter.
+ * @param burst: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_TOKEN_BUCKET(sink_name, rate, burst, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_KV(sink_name, message, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param category: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_CATEGORY(category, format, ...) (void)0
+
 #endif /*< HOB_LOG_STRIP_DEBUG */
 
 #ifdef HOB_LOG_STRIP_TRACE
@@ -155,6 +480,71 @@
  *****************************************************************************************************/
 #define HOB_LOG_TRACE(sink_name, format, ...) (void)0
 
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_EVERY_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param n: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_FIRST_N(sink_name, n, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param milliseconds: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_EVERY_MS(sink_name, milliseconds, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param rate: Does not matter.
+ * @param burst: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_TOKEN_BUCKET(sink_name, rate, burst, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param sink_name: Does not matter.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_KV(sink_name, message, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param category: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_CATEGORY(category, format, ...) (void)0
+
 #endif /*< HOB_LOG_STRIP_TRACE */
 
 #endif /*< HOB_LOG_DETAILS_STRIP_HPP_ */
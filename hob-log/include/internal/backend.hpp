@@ -0,0 +1,89 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file backend.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the threads serving the async sinks.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_BACKEND_HPP_
+#define HOB_LOG_INTERNAL_BACKEND_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cstddef>
+
+#include "details/visibility.hpp"
+#include "notifier.hpp"
+#include "worker.hpp"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+namespace hob::log::backend
+{
+
+/** ***********************************************************************************************
+ * @brief Hands a worker to the backend thread serving the fewest workers, starting the threads if
+ * it is the first one. Every worker is served by a single thread until it is detached, the threads
+ * taking turns between their workers so a busy sink does not starve the others. It is thread-safe.
+ * @param worker: The worker to be served (its queue and its callback need to be usable already).
+ * @returns The notifier of the thread serving the worker, valid until the worker is detached.
+ * @throws std::bad_alloc: If storing the worker fails.
+ * @throws std::system_error: If starting the threads fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern notifier& attach(worker& worker) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Stops serving a worker, waiting for its thread to finish logging its current message. The
+ * threads are stopped once the last worker is detached. It is thread-safe.
+ * @param worker: The worker that has been attached.
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void detach(worker& worker) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Sets the number of threads serving the async sinks (1 by default). It is thread-safe.
+ * @param count: The number of threads.
+ * @returns void
+ * @throws std::invalid_argument: If the count is 0.
+ * @throws std::logic_error: If any worker is attached (the threads are running).
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void set_thread_count(std::size_t count) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Gets the number of threads serving the async sinks. It is thread-safe.
+ * @param void
+ * @returns The number of threads.
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::size_t get_thread_count(void) noexcept;
+
+} /*< namespace hob::log::backend */
+
+#endif /*< HOB_LOG_INTERNAL_BACKEND_HPP_ */
@@ -0,0 +1,78 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file callsite_registry.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the functions managing the process-wide table of call sites, the rules
+ * enabling or disabling them and the reports of their statistics.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_CALLSITE_REGISTRY_HPP_
+#define HOB_LOG_INTERNAL_CALLSITE_REGISTRY_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <vector>
+
+#include "types.hpp"
+#include "details/callsite.hpp"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+namespace hob::log::callsite_registry
+{
+
+/** ***********************************************************************************************
+ * @brief Adds a rule and applies it to the call sites that have been registered so far. The call
+ * sites registered later are checked against it when they are reached. It is thread-safe.
+ * @param filter: Selects the call sites.
+ * @param enabled: true to enable the call sites, false to disable them.
+ * @returns void
+ * @throws std::invalid_argument: If the line range is invalid.
+ * @throws std::bad_alloc: If storing the rule fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void add_rule(const callsite_filter& filter, bool enabled) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Removes all the rules and enables every registered call site. It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void clear_rules(void) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Takes a snapshot of the counters of the registered call sites. It is thread-safe.
+ * @param count: The maximum number of call sites to be returned.
+ * @returns The statistics of the call sites with the most bytes written (then messages sent).
+ * @throws std::bad_alloc: If the creation of the list fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::vector<callsite_statistics> get_statistics(std::size_t count) noexcept(false);
+
+} /*< namespace hob::log::callsite_registry */
+
+#endif /*< HOB_LOG_INTERNAL_CALLSITE_REGISTRY_HPP_ */
@@ -0,0 +1,153 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file category_registry.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the functions managing the process-wide tree of categories.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_CATEGORY_REGISTRY_HPP_
+#define HOB_LOG_INTERNAL_CATEGORY_REGISTRY_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string_view>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "details/visibility.hpp"
+#include "details/category.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log::category_registry
+{
+
+/** ***************************************************************************************************
+ * @brief What the routing table needs to know about a sink, its index being its position in the list.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL sink_entry final
+{
+	std::string	 name;			 /**< The name of the sink.										*/
+	std::uint8_t severity_level; /**< Bitmask of the severities the sink accepts.				*/
+};
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+/** ***********************************************************************************************
+ * @brief Gets the handle of a category, creating it (and its missing ancestors) if needed. It is
+ * thread-safe.
+ * @param name: The path of the category (segments separated by dots, the empty string being the
+ * root).
+ * @returns The handle of the category.
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern category_handle get(std::string_view name) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Overrides the severity level of a category, the change being propagated to the descendants
+ * that inherit it. It is thread-safe.
+ * @param name: The path of the category.
+ * @param severity_level: The severity level bitmask to be set.
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment or the severity level is not in
+ * the [0, 63] interval.
+ * @throws std::bad_alloc: If creating the category fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void set_level(std::string_view name, std::uint8_t severity_level) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Makes a category inherit the severity level of its parent again (the root goes back to
+ * accepting every severity). It is thread-safe.
+ * @param name: The path of the category.
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void reset_level(std::string_view name) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Routes a category to a sink, the change being propagated to the descendants that inherit
+ * it. It is thread-safe.
+ * @param name: The path of the category.
+ * @param sink_name: The name of the sink (empty string to stop logging the category).
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category or storing the sink name fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void set_sink(std::string_view name, std::string_view sink_name) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Makes a category inherit the sink of its parent again (the root goes back to not being
+ * routed). It is thread-safe.
+ * @param name: The path of the category.
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void reset_sink(std::string_view name) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Adds a route: the messages of the given severities logged under a category (or any of its
+ * descendants) are sent to a sink as well. The routes are added to the sink the category is
+ * routed to, so a message can be sent to multiple sinks. It is thread-safe.
+ * @param name: The path of the category.
+ * @param severity_level: The severities that are being routed.
+ * @param sink_name: The name of the sink.
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment or the severity level is not in
+ * the [0, 63] interval.
+ * @throws std::bad_alloc: If creating the category or storing the route fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void add_route(std::string_view name, std::uint8_t severity_level, std::string_view sink_name) noexcept(false);
+
+/** ***********************************************************************************************
+ * @brief Removes all the routes that have been added. It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void clear_routes(void) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Sets the sinks the routing table indexes and rebuilds it. It is called by the logger every
+ * time the sinks or their configuration change. Only the first sinks fit in the table (@see
+ * details::MAXIMUM_ROUTED_SINKS), the others not being reachable through the categories. It is
+ * thread-safe.
+ * @param sinks: The sinks, in the order of their indices.
+ * @returns void
+ * @throws std::bad_alloc: If storing the sinks fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void set_sinks(std::vector<sink_entry> sinks) noexcept(false);
+
+} /*< namespace hob::log::category_registry */
+
+#endif /*< HOB_LOG_INTERNAL_CATEGORY_REGISTRY_HPP_ */
@@ -0,0 +1,79 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file clock.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the functions reading the timestamp sources and converting their raw
+ * values to wall time.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_CLOCK_HPP_
+#define HOB_LOG_INTERNAL_CLOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cstdint>
+
+#include "types.hpp"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+namespace hob::log::clock
+{
+
+/** ***********************************************************************************************
+ * @brief Reads the raw value of a timestamp source. This is the only part done by the thread that
+ * logs the message. It is thread-safe.
+ * @param source: The clock to be read.
+ * @returns Nanoseconds since the epoch for the system clocks, ticks for the time stamp counter.
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::uint64_t read(timestamp_source source) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Converts a raw value of a timestamp source to wall time. For the time stamp counter the base
+ * is recalibrated against the system clock once per second of ticks. It is thread-safe.
+ * @param source: The clock the value has been read from.
+ * @param ticks: The raw value (@see read()).
+ * @returns Nanoseconds since the epoch.
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::int64_t to_nanoseconds(timestamp_source source, std::uint64_t ticks) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Measures the frequency of the time stamp counter and sets the base of the conversion. It
+ * is done automatically on the first conversion, calling it at initialization keeps the measurement
+ * out of the logging path. It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void calibrate(void) noexcept;
+
+} /*< namespace hob::log::clock */
+
+#endif /*< HOB_LOG_INTERNAL_CLOCK_HPP_ */
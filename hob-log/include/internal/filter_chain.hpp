@@ -0,0 +1,127 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file filter_chain.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the filter_chain class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_FILTER_CHAIN_HPP_
+#define HOB_LOG_INTERNAL_FILTER_CHAIN_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "record.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief This class compiles the filters of a sink into a flat array of predicates.
+ * @details The filters are compiled only once, when they are set, each one into a pointer to the
+ * function matching its field and the span of its pattern. When a message is being logged the
+ * predicates are evaluated in order before anything is formatted, the ones matching the content of
+ * the message (which needs the message to be formatted) being moved after all the others so they
+ * are reached only by the messages that passed the cheap checks.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL filter_chain final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Creates an empty chain (every message passes it).
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	filter_chain(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Compiles new filters, replacing the previous ones. It is **not** thread-safe.
+	 * @param filters: The filters to be compiled (empty to let every message pass).
+	 * @returns void
+	 * @throws std::invalid_argument: If the field of a filter is not known.
+	 * @throws std::bad_alloc: If making the copy of the patterns or of the predicates fails.
+	 *************************************************************************************************/
+	void compile(const std::vector<sink_filter>& filters) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Gets the filters that have been compiled, in the order they have been given. The patterns
+	 * are valid as long as the chain is not compiled again. It is thread-safe.
+	 * @param void
+	 * @returns The filters.
+	 * @throws std::bad_alloc: If the creation of the list fails.
+	 *************************************************************************************************/
+	[[nodiscard]] std::vector<sink_filter> get_filters(void) const noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Checks if a message passes every filter. It is thread-safe.
+	 * @param record: Everything that has been captured when the message has been logged.
+	 * @returns true - the message passes the filters.
+	 * @returns false - the message is filtered.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool passes(const record& record) const noexcept;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The function matching a field of the record against a pattern.
+	 *************************************************************************************************/
+	using matcher = bool (*)(const record& record, std::string_view pattern) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief A compiled filter (the pattern is stored as offsets so the copies stay valid).
+	 *************************************************************************************************/
+	struct predicate final
+	{
+		matcher				match;		/**< The function matching the field of the filter.			*/
+		std::size_t			offset;		/**< The index of the pattern inside the patterns.			*/
+		std::size_t			length;		/**< The length of the pattern inside the patterns.			*/
+		bool				exclude;	/**< The matching messages are rejected instead of the others.	*/
+		sink_filter::field	target;		/**< What the pattern is matched against.						*/
+		std::size_t			index;		/**< The position of the filter as it has been given.		*/
+	};
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The patterns of the filters, one after the other.
+	 *************************************************************************************************/
+	std::string patterns;
+
+	/** ***********************************************************************************************
+	 * @brief The predicates that the filters have been compiled into, in the order of evaluation.
+	 *************************************************************************************************/
+	std::vector<predicate> predicates;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_FILTER_CHAIN_HPP_ */
@@ -0,0 +1,150 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file log_queue.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the log_queue interface.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_LOG_QUEUE_HPP_
+#define HOB_LOG_INTERNAL_LOG_QUEUE_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <memory>
+#include <span>
+#include <cstddef>
+
+#include "details/visibility.hpp"
+#include "record.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The size of a cache line, the unit the slots and the positions are being aligned to so that
+ * the threads do not invalidate each other's caches (false sharing).
+ *****************************************************************************************************/
+inline constexpr std::size_t CACHE_LINE_SIZE = 64UL;
+
+/** ***************************************************************************************************
+ * @brief The number of slots of a queue if the configuration of the sink does not specify it.
+ *****************************************************************************************************/
+inline constexpr std::size_t DEFAULT_QUEUE_CAPACITY = 4096UL;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Interface of the queues the logging threads hand the messages of an async sink to the backend
+ * through. The suppliers can be any thread, the consumer is only the backend thread serving the sink.
+ * The queues do not wait, waking the consumer up being up to the worker (@see notifier).
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL log_queue
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Virtual destructor to avoid polymorphically delete undefined behavior.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	virtual ~log_queue(void) noexcept = default;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the queue has any message stored in it. It needs to be called by the consumer.
+	 * @param void
+	 * @returns true - queue is empty.
+	 * @returns false - queue has at least 1 message.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] virtual bool is_empty(void) const noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Copies the log record at the end of the queue. It is thread-safe.
+	 * @param record: The record of the log.
+	 * @returns true - the log has been emplaced successfully.
+	 * @returns false - the log has been lost (the queue is full or the copy failed).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] virtual bool emplace(const record& record) noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Places a line that has already been formatted at the end of the queue. It is
+	 * thread-safe.
+	 * @param callsite: Where the message has been logged (static storage).
+	 * @param line: The formatted line (shared, it is not copied).
+	 * @returns true - the log has been emplaced successfully.
+	 * @returns false - the log has been lost (the queue is full).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] virtual bool emplace(const details::callsite* callsite, const std::shared_ptr<const std::string>& line) noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the record at the beginning of the queue, without removing it. It needs to be called
+	 * by the consumer.
+	 * @param void
+	 * @returns The first record stored (valid until pop() is called) or nullptr if the queue is empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] virtual const stored_record* front(void) noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Removes the record returned by front(), handing its slot back to the suppliers. It needs
+	 * to be called by the consumer.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	virtual void pop(void) noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the records at the beginning of the queue, without removing them, so they can be
+	 * logged in one go. It needs to be called by the consumer.
+	 * @param records: Where the records are stored (its size is the maximum number of records).
+	 * @returns The number of records stored (valid until pop() is called), 0 if the queue is empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] virtual std::size_t front(std::span<const stored_record*> records) noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Removes the records returned by front(), handing their slots back to the suppliers. It
+	 * needs to be called by the consumer.
+	 * @param count: The number of records returned by front().
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	virtual void pop(std::size_t count) noexcept = 0;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_LOG_QUEUE_HPP_ */
@@ -0,0 +1,232 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file merging_queue.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the merging_queue class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_MERGING_QUEUE_HPP_
+#define HOB_LOG_INTERNAL_MERGING_QUEUE_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#include "details/visibility.hpp"
+#include "types.hpp"
+#include "log_queue.hpp"
+#include "thread_queue.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief Queue made of one single supplier queue per logging thread, merged by timestamp by the
+ * consumer.
+ * @details A thread gets its queue the first time it logs to the sink (the only time a mutex is
+ * being taken), so afterwards the suppliers do not share any cache line that is being written. The
+ * consumer adopts the new queues, logs the earliest record at the beginning of any of them (a k-way
+ * merge, so the output stays ordered as long as the records reach the queues in time) and releases
+ * the queues of the threads that have exited once they have been emptied. The records are merged by
+ * their timestamp, or by a reading of the clock of the sink if they have not been timestamped.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL merging_queue final : public log_queue
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Creates the queue without any thread queue.
+	 * @param capacity: The number of slots of every thread queue (rounded up to a power of 2).
+	 * @param clock: The clock of the sink, read to merge the records that have not been timestamped.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	merging_queue(std::size_t capacity, timestamp_source clock) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Abandons the thread queues, so the threads release them.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	~merging_queue(void) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if any thread queue has a message stored in it. It needs to be called by the
+	 * consumer.
+	 * @param void
+	 * @returns true - every thread queue is empty.
+	 * @returns false - at least 1 message is queued.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_empty(void) const noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Copies the log record at the end of the queue of the calling thread. It is thread-safe.
+	 * @param record: The record of the log.
+	 * @returns true - the log has been emplaced successfully.
+	 * @returns false - the log has been lost (the queue is full or the copy failed).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool emplace(const record& record) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Places a line that has already been formatted at the end of the queue of the calling
+	 * thread. It is thread-safe.
+	 * @param callsite: Where the message has been logged (static storage).
+	 * @param line: The formatted line (shared, it is not copied).
+	 * @returns true - the log has been emplaced successfully.
+	 * @returns false - the log has been lost (the queue is full).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool emplace(const details::callsite* callsite, const std::shared_ptr<const std::string>& line) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the earliest record at the beginning of the thread queues, without removing it. It
+	 * needs to be called by the consumer.
+	 * @param void
+	 * @returns The earliest record (valid until pop() is called) or nullptr if the queues are empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] const stored_record* front(void) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Removes the record returned by front() from its thread queue. It needs to be called by
+	 * the consumer.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void pop(void) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the records at the beginning of the thread queue holding the earliest one, up to the
+	 * first record that is later than the beginning of another thread queue, without removing them.
+	 * It needs to be called by the consumer.
+	 * @param records: Where the records are stored (its size is the maximum number of records).
+	 * @returns The number of records stored (valid until pop() is called), 0 if the queues are empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::size_t front(std::span<const stored_record*> records) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Removes the records returned by front() from their thread queue. It needs to be called by
+	 * the consumer.
+	 * @param count: The number of records returned by front().
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void pop(std::size_t count) noexcept override;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief Gets the queue of the calling thread, creating and registering it on the first call. The
+	 * queues the thread has registered with merging queues that are gone are released. It is
+	 * thread-safe.
+	 * @param void
+	 * @returns The queue of the calling thread.
+	 * @throws std::bad_alloc: If the allocation of the queue fails.
+	 *************************************************************************************************/
+	[[nodiscard]] thread_queue& get_thread_queue(void) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Moves the queues registered since the previous call to the merged ones. It needs to be
+	 * called by the consumer.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void adopt(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Finds the thread queue holding the earliest record, releasing on the way the queues of
+	 * the threads that have exited if they are empty. It needs to be called by the consumer.
+	 * @param next_key: The key of the earliest record at the beginning of the other queues
+	 * (UINT64_MAX if they are all empty).
+	 * @returns The queue or nullptr if they are all empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] thread_queue* find_earliest(std::uint64_t& next_key) noexcept;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief Distinguishes the queue in the registrations of the threads (never reused).
+	 *************************************************************************************************/
+	const std::uint64_t identifier;
+
+	/** ***********************************************************************************************
+	 * @brief The number of slots of every thread queue.
+	 *************************************************************************************************/
+	const std::size_t capacity;
+
+	/** ***********************************************************************************************
+	 * @brief The clock read to merge the records that have not been timestamped.
+	 *************************************************************************************************/
+	const timestamp_source clock;
+
+	/** ***********************************************************************************************
+	 * @brief Protects the registered queues.
+	 *************************************************************************************************/
+	mutable std::mutex registration_mutex;
+
+	/** ***********************************************************************************************
+	 * @brief The queues registered by the threads that have not been adopted by the consumer yet.
+	 *************************************************************************************************/
+	std::vector<std::shared_ptr<thread_queue>> registered_queues;
+
+	/** ***********************************************************************************************
+	 * @brief How many queues have been registered, so the consumer does not take the mutex to find
+	 * out there is none to adopt.
+	 *************************************************************************************************/
+	std::atomic<std::uint64_t> registrations_count;
+
+	/** ***********************************************************************************************
+	 * @brief How many queues the consumer has adopted.
+	 *************************************************************************************************/
+	std::uint64_t adoptions_count;
+
+	/** ***********************************************************************************************
+	 * @brief The queues being merged (owned by the consumer).
+	 *************************************************************************************************/
+	std::vector<std::shared_ptr<thread_queue>> queues;
+
+	/** ***********************************************************************************************
+	 * @brief The queue of the record returned by front() (nullptr if there is none).
+	 *************************************************************************************************/
+	thread_queue* front_queue;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_MERGING_QUEUE_HPP_ */
@@ -0,0 +1,167 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file message_formatter.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the message_formatter class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_MESSAGE_FORMATTER_HPP_
+#define HOB_LOG_INTERNAL_MESSAGE_FORMATTER_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "details/visibility.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The values that can be substituted inside a message format.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL message_fields final
+{
+	std::string_view time;			/**< The time when the message has been logged (already formatted). */
+	std::string_view tag;			/**< Tag indicating the type of message.							  */
+	std::string_view file_path;		/**< The path of the file where the log function is being called.	  */
+	std::string_view file_name;		/**< The file path without the directories.						  */
+	std::string_view function_name; /**< The name of the function where this call is made.				  */
+	std::int32_t	 line;			/**< The line where the log function is being called.				  */
+	std::string_view thread_id;		/**< The identifier of the thread that logged the message.			  */
+	std::string_view thread_name;	/**< The name of the thread that logged the message.				  */
+	std::string_view message;		/**< The message to be logged.										  */
+	std::string_view context;		/**< The context of the thread as "key=value" pairs.				  */
+};
+
+/** ***************************************************************************************************
+ * @brief This class compiles a message format into a sequence of tokens.
+ * @details The format is parsed only once, when it is set, into literal spans and field opcodes. When
+ * a message is being logged only the fields that are present in the format are being appended to the
+ * destination, avoiding scanning the format once for every supported placeholder.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL message_formatter final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Enumerates the operations that a format can be compiled into.
+	 *************************************************************************************************/
+	enum class field : std::uint8_t
+	{
+		LITERAL,	 /**< Text copied as it is from the format. */
+		TIME,		 /**< {TIME} placeholder.				   */
+		TAG,		 /**< {TAG} placeholder.					   */
+		FILE_LONG,	 /**< {FILE:long} placeholder.			   */
+		FILE_SHORT,	 /**< {FILE:short} placeholder.			   */
+		FUNCTION,	 /**< {FUNCTION} placeholder.			   */
+		LINE,		 /**< {LINE} placeholder.				   */
+		HOST,		 /**< {HOST} placeholder.				   */
+		PID,		 /**< {PID} placeholder.					   */
+		THREAD,		 /**< {THREAD} placeholder.				   */
+		THREAD_NAME, /**< {THREAD_NAME} placeholder.		   */
+		MESSAGE,	 /**< {MESSAGE} placeholder.			   */
+		CONTEXT		 /**< {CONTEXT} placeholder.			   */
+	};
+
+	/** ***********************************************************************************************
+	 * @brief Creates an empty formatter (a format needs to be compiled before it can be used).
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	message_formatter(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Compiles a new message format, replacing the previous one. It is **not** thread-safe.
+	 * @param format: The message format to be compiled.
+	 * @returns void
+	 * @throws std::invalid_argument: If the format does not contain the specifier for the log message.
+	 * @throws std::bad_alloc: If making the copy of the message format or of the tokens fails.
+	 *************************************************************************************************/
+	void compile(std::string_view format) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Gets the message format that has been compiled. It is thread-safe.
+	 * @param void
+	 * @returns The current message format.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::string_view get_format(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if a placeholder is present in the compiled format. It is thread-safe.
+	 * @param field: The field to be checked.
+	 * @returns true - the field is used by the format.
+	 * @returns false - the field is not used by the format.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool contains(field field) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Appends the formatted message to the destination. It is thread-safe.
+	 * @param destination: The string the formatted message will be appended to.
+	 * @param fields: The values that will replace the placeholders.
+	 * @returns void
+	 * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+	 *************************************************************************************************/
+	void format(std::string& destination, const message_fields& fields) const noexcept(false);
+
+private:
+	/** ***********************************************************************************************
+	 * @brief A compiled operation (literal spans are stored as offsets so the copies stay valid).
+	 *************************************************************************************************/
+	struct token final
+	{
+		field		type;	/**< The operation of the token.									*/
+		std::size_t offset; /**< The index of the literal inside the format (only for literals). */
+		std::size_t length; /**< The length of the literal inside the format (only for literals). */
+	};
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The format of the message as it has been given.
+	 *************************************************************************************************/
+	std::string source;
+
+	/** ***********************************************************************************************
+	 * @brief The operations that the format has been compiled into.
+	 *************************************************************************************************/
+	std::vector<token> tokens;
+
+	/** ***********************************************************************************************
+	 * @brief Bitmask where the bit at the position of a field is set if the format contains it.
+	 *************************************************************************************************/
+	std::uint32_t fields_mask;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_MESSAGE_FORMATTER_HPP_ */
@@ -34,12 +34,13 @@
  *****************************************************************************************************/
 
 #include <string>
-#include <queue>
-#include <mutex>
-#include <condition_variable>
-#include <optional>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
 
 #include "details/visibility.hpp"
+#include "log_queue.hpp"
 
 /******************************************************************************************************
  * TYPE DEFINITIONS
@@ -49,71 +50,154 @@ namespace hob::log
 {
 
 /** ***************************************************************************************************
- * @brief Thread safe STL queue for one consumer thread and one supplier thread.
- * @details It is used for sending messages to the thread that does the logging. In the case of
- * multiple consumer threads one might empty the queue after the other checked it is not empty. This
- * case is accepted as for the moment is not used this way.
+ * @brief Bounded lock-free queue for multiple supplier threads and one consumer thread.
+ * @details It is used for sending messages to the thread that does the logging. The slots are being
+ * allocated once, when the queue is created, and each one is reused by every message passing through
+ * it (the storage of the copied fields included). Each slot has a sequence number telling whose turn
+ * it is: a supplier claims the slot at the end of the queue by advancing the position with a single
+ * compare and swap, copies the record into it and publishes it by advancing its sequence, and the
+ * consumer frees it the same way after logging it (Dmitry Vyukov's bounded queue). A full queue does
+ * not block the suppliers, the message being lost instead.
  *****************************************************************************************************/
-class HOB_LOG_LOCAL message_queue final
+class HOB_LOG_LOCAL message_queue final : public log_queue
 {
 public:
 	/** ***********************************************************************************************
-	 * @brief The data type of the log that is being stored inside the queue.
+	 * @brief Allocates the slots of the queue.
+	 * @param capacity: The number of slots (rounded up to a power of 2, at least 2).
+	 * @throws std::bad_alloc: If the allocation of the slots fails.
 	 *************************************************************************************************/
-	using payload = std::pair<std::uint8_t, std::string>;
+	explicit message_queue(std::size_t capacity) noexcept(false);
 
 	/** ***********************************************************************************************
-	 * @brief Checks if the queue has any message stored in it.
+	 * @brief Gets the number of slots of the queue.
+	 * @param void
+	 * @returns The maximum number of messages that can be queued.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::size_t get_capacity(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the queue has any message stored in it. It needs to be called by the consumer.
 	 * @param void
 	 * @returns true - queue is empty.
 	 * @returns false - queue has at least 1 message.
 	 * @throws N/A.
 	 *************************************************************************************************/
-	[[nodiscard]] bool is_empty(void) const noexcept;
+	[[nodiscard]] bool is_empty(void) const noexcept override;
 
 	/** ***********************************************************************************************
-	 * @brief Emplaces a log at the end of the queue.
-	 * @param severity_bit: Bit indicating the type of message that is being logged (see
-	 * hob::log::severity_level).
-	 * @param message: The message of the log.
+	 * @brief Copies the log record into the slot at the end of the queue. It is thread-safe.
+	 * @param record: The record of the log.
 	 * @returns true - the log has been emplaced successfully.
-	 * @returns false - the log has been lost.
+	 * @returns false - the log has been lost (the queue is full or the copy failed).
 	 * @throws N/A.
 	 *************************************************************************************************/
-	[[nodiscard]] bool emplace(std::uint8_t severity_bit, std::string&& message) noexcept;
+	[[nodiscard]] bool emplace(const record& record) noexcept override;
 
 	/** ***********************************************************************************************
-	 * @brief Gets the message at the beginning of the list and removes it. If the queue is empty waits
-	 * until a message is being emplaced.
+	 * @brief Places a line that has already been formatted in the slot at the end of the queue. It is
+	 * thread-safe.
+	 * @param callsite: Where the message has been logged (static storage).
+	 * @param line: The formatted line (shared, it is not copied).
+	 * @returns true - the log has been emplaced successfully.
+	 * @returns false - the log has been lost (the queue is full).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool emplace(const details::callsite* callsite, const std::shared_ptr<const std::string>& line) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the record at the beginning of the queue, without removing it. It needs to be called
+	 * by the consumer.
 	 * @param void
-	 * @returns The first message stored.
+	 * @returns The first record stored (valid until pop() is called) or nullptr if the queue is empty.
 	 * @throws N/A.
 	 *************************************************************************************************/
-	[[nodiscard]] std::optional<payload> pop(void) noexcept;
+	[[nodiscard]] const stored_record* front(void) noexcept override;
 
 	/** ***********************************************************************************************
-	 * @brief Guarantees that the consumer thread is not stuck waiting in a pop() call.
+	 * @brief Removes the record returned by front(), handing its slot back to the suppliers. It needs
+	 * to be called by the consumer.
 	 * @param void
 	 * @returns void
 	 * @throws N/A.
 	 *************************************************************************************************/
-	void interrupt_wait(void) noexcept;
+	void pop(void) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the records at the beginning of the queue, without removing them. The range stops
+	 * before a record whose copy has failed. It needs to be called by the consumer.
+	 * @param records: Where the records are stored (its size is the maximum number of records).
+	 * @returns The number of records stored (valid until pop() is called), 0 if the queue is empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::size_t front(std::span<const stored_record*> records) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Removes the records returned by front(), handing their slots back to the suppliers. It
+	 * needs to be called by the consumer.
+	 * @param count: The number of records returned by front().
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void pop(std::size_t count) noexcept override;
 
 private:
 	/** ***********************************************************************************************
-	 * @brief The queue where the messages are being placed.
+	 * @brief A preallocated slot, on its own cache lines.
+	 *************************************************************************************************/
+	struct alignas(CACHE_LINE_SIZE) slot final
+	{
+		std::atomic<std::uint64_t> sequence; /**< Position + 1 if it holds a record, the position otherwise.	 */
+		bool					   is_lost;	 /**< The copy of the record failed so it is skipped.			 */
+		stored_record			   record;	 /**< The record, its storage being reused.						 */
+	};
+
+	/** ***********************************************************************************************
+	 * @brief Claims the slot at the end of the queue. It is thread-safe.
+	 * @param void
+	 * @returns The claimed slot or nullptr if the queue is full.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] slot* claim(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Hands a claimed slot to the consumer. It is thread-safe.
+	 * @param slot: The slot returned by claim().
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void publish(slot& slot) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the slot at the beginning of the queue has been published.
+	 * @param void
+	 * @returns true - a record (possibly lost) is waiting to be consumed.
+	 * @returns false - queue is empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_ready(void) const noexcept;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The slots of the queue (a power of 2, so positions are mapped to them by a mask).
+	 *************************************************************************************************/
+	std::unique_ptr<slot[]> slots;
+
+	/** ***********************************************************************************************
+	 * @brief The number of slots minus one.
 	 *************************************************************************************************/
-	std::queue<payload> queue;
+	std::uint64_t mask;
 
 	/** ***********************************************************************************************
-	 * @brief The mutex protecting the queue from multiple threads access.
+	 * @brief The position the next supplier claims (shared by the suppliers).
 	 *************************************************************************************************/
-	mutable std::mutex mutex;
+	alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> enqueue_position;
 
 	/** ***********************************************************************************************
-	 * @brief The variable that controls the consumer and the supplier thread.
+	 * @brief The position of the record at the beginning of the queue (owned by the consumer).
 	 *************************************************************************************************/
-	std::condition_variable condition_notifier;
+	alignas(CACHE_LINE_SIZE) std::uint64_t dequeue_position;
 };
 
 } /*< namespace hob::log */
@@ -0,0 +1,126 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file notifier.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the notifier class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_NOTIFIER_HPP_
+#define HOB_LOG_INTERNAL_NOTIFIER_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <atomic>
+#include <cstdint>
+
+#include "details/visibility.hpp"
+#include "log_queue.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief Puts a consumer thread to sleep until any of the queues it serves gets a message.
+ * @details The consumer announces that it is about to sleep, checks its queues one more time and
+ * only then waits, so a message published in the meantime is never missed. The suppliers only make a
+ * system call when the consumer is sleeping, and out of all the ones publishing at the same time
+ * (e.g. a message being sent to multiple sinks served by the same thread) only the first one wakes it
+ * up.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL notifier final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Creates the notifier with the consumer being awake.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	notifier(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Wakes the consumer up if it is sleeping. It needs to be called after a message has been
+	 * published. It is thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void notify(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Announces that the consumer is about to sleep. The queues need to be checked afterwards
+	 * and either wait() or cancel_wait() to be called. It needs to be called by the consumer.
+	 * @param void
+	 * @returns The value to be passed to wait().
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::uint32_t prepare_wait(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Sleeps until notify() or interrupt() is called (returns immediately if either of them has
+	 * been called since prepare_wait()). It needs to be called by the consumer.
+	 * @param wake_value: The value returned by prepare_wait().
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void wait(std::uint32_t wake_value) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Announces that the consumer does not sleep after all (a queue is not empty). It needs to
+	 * be called by the consumer.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void cancel_wait(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Wakes the consumer up unconditionally (e.g. for it to stop). It is thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void interrupt(void) noexcept;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief Flag indicating that the consumer is about to sleep, so it needs to be woken up.
+	 *************************************************************************************************/
+	alignas(CACHE_LINE_SIZE) std::atomic<bool> is_waiting;
+
+	/** ***********************************************************************************************
+	 * @brief Counter the consumer sleeps on, incremented to wake it up.
+	 *************************************************************************************************/
+	std::atomic<std::uint32_t> wake_count;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_NOTIFIER_HPP_ */
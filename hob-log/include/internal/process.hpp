@@ -0,0 +1,86 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file process.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the cache of the process-constant fields.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_PROCESS_HPP_
+#define HOB_LOG_INTERNAL_PROCESS_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string_view>
+
+#include "details/visibility.hpp"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+namespace hob::log::process
+{
+
+/** ***********************************************************************************************
+ * @brief Renders again the name of the host and the identifier of the process, publishing a new copy
+ * of them if they have changed. It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void refresh(void) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Makes the child processes refresh the cache automatically after fork(). Calling it multiple
+ * times registers the handler only once. It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void register_fork_handler(void) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Gets the cached name of the host. It is thread-safe (the viewed values are never rewritten
+ * while other threads can read them).
+ * @param void
+ * @returns The name of the host or unkown if it could not be found (empty if it has not been
+ * refreshed yet).
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::string_view get_host_name(void) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Gets the cached identifier of the process in decimal form. It is thread-safe (the viewed
+ * values are never rewritten while other threads can read them).
+ * @param void
+ * @returns The identifier of the process (empty if it has not been refreshed yet).
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::string_view get_process_id(void) noexcept;
+
+} /*< namespace hob::log::process */
+
+#endif /*< HOB_LOG_INTERNAL_PROCESS_HPP_ */
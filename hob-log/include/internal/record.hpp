@@ -0,0 +1,175 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file record.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the record structure and the stored_record class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_RECORD_HPP_
+#define HOB_LOG_INTERNAL_RECORD_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <memory>
+#include <cstdint>
+
+#include "details/visibility.hpp"
+#include "details/arguments.hpp"
+#include "details/callsite.hpp"
+#include "details/fields.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief Everything that has been captured when a message has been logged. The message itself is not
+ * formatted yet, it is kept as the format and its encoded arguments (@see arguments.hpp). A structured
+ * message keeps its encoded key-value fields instead of the arguments, the format being the message.
+ * The path of the category is owned by the category registry, so it lives until the end of the program.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL record final
+{
+	const details::callsite*	callsite;			/**< Where the message has been logged (static storage).				*/
+	std::uint64_t				suppressed_count;	/**< Calls of the call site dropped since the previous logged one.		*/
+	std::uint64_t				timestamp;			/**< Raw value of the timestamp source of the sink (set by the sink).	*/
+	std::string_view			thread_id;			/**< The identifier of the thread that logged the message.				*/
+	std::string_view			thread_name;		/**< The name of the thread that logged the message.					*/
+	std::string_view			format;				/**< The text to be written (static storage unless structured).			*/
+	details::decoder			decode;				/**< Formats the arguments (nullptr if the arguments are the message).	*/
+	std::string_view			arguments;			/**< The encoded arguments or the message if it is already formatted.	*/
+	bool						is_structured;		/**< The arguments are encoded key-value fields (@see fields.hpp).		*/
+	std::string_view			category;			/**< The path of the category (empty if logged by sink name).			*/
+	std::string_view			context;			/**< The context of the thread rendered as text (@see context.hpp).		*/
+	std::string_view			context_fields;		/**< The context of the thread as encoded fields.						*/
+
+	/** ***********************************************************************************************
+	 * @brief Appends the message (the format with the arguments substituted) to the destination. The
+	 * fields of a structured message are appended after it as "key=value" pairs. If calls of the call
+	 * site have been dropped their number is appended after it.
+	 * @param destination: The string the message will be appended to.
+	 * @returns void
+	 * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+	 * @throws std::format_error: If an argument can not be formatted (e.g. a negative dynamic width or a
+	 * formatter that throws).
+	 *************************************************************************************************/
+	void format_message(std::string& destination) const noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Appends the message of a structured record followed by its fields as "key=value" pairs.
+	 * @param destination: The string the message will be appended to.
+	 * @returns void
+	 * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+	 *************************************************************************************************/
+	void format_fields(std::string& destination) const noexcept(false);
+};
+
+/** ***************************************************************************************************
+ * @brief Owning copy of a record, so it can be formatted on another thread after the memory it was
+ * viewing has been reused. The call site and the format have static storage so only the thread
+ * identifier, thread name, arguments and context are copied (in a single buffer), along with the
+ * message of a structured record. Alternatively it can
+ * hold a line that has already been formatted once for multiple sinks.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL stored_record final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Makes an empty record, the storage of a queue slot that is being reused for every
+	 * message passing through it.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	stored_record(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Makes a copy of the record, reusing the storage of the previous one.
+	 * @param record: The record to be copied.
+	 * @returns void
+	 * @throws std::bad_alloc: If the copy of the variable length fields fails.
+	 *************************************************************************************************/
+	void assign(const record& record) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Stores a line that has already been formatted (shared with other sinks, so it is not
+	 * copied).
+	 * @param callsite: Where the message has been logged (static storage).
+	 * @param line: The formatted line (can not be nullptr).
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void assign(const details::callsite* callsite, std::shared_ptr<const std::string> line) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Releases the shared line, if any, once the record has been logged. The storage of the
+	 * copied fields is kept for the next record.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void release(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Gets a view of the copied record. It is valid as long as this object is not modified.
+	 * @param void
+	 * @returns The record.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] record get(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the line that has already been formatted.
+	 * @param void
+	 * @returns The formatted line or nullptr if the record still needs to be formatted.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] const std::shared_ptr<const std::string>& get_line(void) const noexcept;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The record, with the variable length fields viewing the previous storage.
+	 *************************************************************************************************/
+	record header;
+
+	/** ***********************************************************************************************
+	 * @brief The thread identifier, the thread name, the message (if structured), the arguments and
+	 * the two renderings of the context, one after the other.
+	 *************************************************************************************************/
+	std::string payload;
+
+	/** ***********************************************************************************************
+	 * @brief The line that has already been formatted (nullptr if the record needs to be formatted).
+	 *************************************************************************************************/
+	std::shared_ptr<const std::string> line;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_RECORD_HPP_ */
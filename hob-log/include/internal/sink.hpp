@@ -37,6 +37,7 @@
 #include <cstdint>
 
 #include "details/visibility.hpp"
+#include "record.hpp"
 
 /******************************************************************************************************
  * TYPE DEFINITIONS
@@ -69,22 +70,28 @@ public:
 
 	/** ***********************************************************************************************
 	 * @brief Pure virtual method allowing children to log the message based on their type.
-	 * @param severity_bit: Bit indicating the type of message that is being logged (see
-	 * hob::log::severity_level).
-	 * @param tag: Tag indicating the type of message.
-	 * @param file_path: The path of the file where the log function is being called.
-	 * @param function_name: The name of the function where this call is made.
-	 * @param line: The line where the log function is being called.
-	 * @param message: The message to be logged.
+	 * @param record: Everything that has been captured when the message has been logged.
 	 * @returns void
 	 * @throws N/A.
 	 *************************************************************************************************/
-	virtual void log(std::uint8_t	  severity_bit,
-					 std::string_view tag,
-					 std::string_view file_path,
-					 std::string_view function_name,
-					 std::int32_t	  line,
-					 std::string_view message) noexcept = 0;
+	virtual void log(const record& record) noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the severities the sink accepts. It is thread-safe.
+	 * @param void
+	 * @returns Bitmask where bits set to 0 filter messages of that severity.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] virtual std::uint8_t get_severity_level(void) const noexcept = 0;
+
+	/** ***********************************************************************************************
+	 * @brief Notifies the sink that the configuration of a sink has been changed, so it can update
+	 * what it has derived from it. It is **not** thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	virtual void on_configuration_changed(void) noexcept;
 
 	/** ***********************************************************************************************
 	 * @brief Gets the name of the sink. It is thread-safe.
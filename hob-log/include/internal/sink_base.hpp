@@ -27,9 +27,18 @@
 #include <optional>
 #include <memory>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <string>
+#include <span>
+#include <cstdio>
 
 #include "types.hpp"
 #include "sink.hpp"
+#include "message_formatter.hpp"
+#include "time_formatter.hpp"
+#include "filter_chain.hpp"
 
 /******************************************************************************************************
  * FORWARD DECLARATIONS
@@ -44,6 +53,15 @@ class worker;
  * TYPE DEFINITIONS
  *****************************************************************************************************/
 
+/** ***************************************************************************************************
+ * @brief A formatted line of a batch handed to a concrete sink.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL sink_line final
+{
+	std::uint8_t	 severity_bit; /**< Bit indicating the severity of the message (see severity_level).	*/
+	std::string_view message;	   /**< The formatted line, new line included.							*/
+};
+
 /** ***************************************************************************************************
  * @brief This class implements the common propierties of the sinks (besides composed sink).
  *****************************************************************************************************/
@@ -70,23 +88,13 @@ public:
 	virtual ~sink_base(void) noexcept;
 
 	/** ***********************************************************************************************
-	 * @brief Processes the message and delegates it to the concrete sink.
-	 * @param severity_bit: Bit indicating the type of message that is being logged (see
-	 * hob::log::severity_level).
-	 * @param tag: Tag indicating the type of message.
-	 * @param file_path: The path of the file where the log function is being called.
-	 * @param function_name: The name of the function where this call is made.
-	 * @param line: The line where the log function is being called.
-	 * @param message: The message to be logged.
+	 * @brief Processes the message and delegates it to the concrete sink. In async mode only a copy of
+	 * the record is made on the calling thread, the formatting being done by the backend thread.
+	 * @param record: Everything that has been captured when the message has been logged.
 	 * @returns void
 	 * @throws N/A.
 	 *************************************************************************************************/
-	void log(std::uint8_t	  severity_bit,
-			 std::string_view tag,
-			 std::string_view file_path,
-			 std::string_view function_name,
-			 std::int32_t	  line,
-			 std::string_view message) noexcept override final;
+	void log(const record& record) noexcept override final;
 
 	/** ***********************************************************************************************
 	 * @brief Sets a new message format. It is **not** thread-safe. The supported placeholders are:
@@ -99,7 +107,10 @@ public:
 	 * - {HOST}: The name of the host on which the program is running.
 	 * - {PID}: The identifier of the process that logged the message.
 	 * - {THREAD}: The identifier of the thread that logged the message.
+	 * - {THREAD_NAME}: The name of the thread that logged the message (@see set_thread_name()), its
+	 * identifier if it has not been named.
 	 * - {MESSAGE}: The message to be logged. This is mandatory!
+	 * - {CONTEXT}: The fields of the thread context as "key=value" pairs (@see scoped_context).
 	 * @param sink_name: The name of the sink the format will be set to.
 	 * @param format: The message format to be set.
 	 * @returns void
@@ -134,6 +145,9 @@ public:
 	 * - {MINUTE}: The minute (in numeric form, [0, 59]) when the message has been logged.
 	 * - {SECOND}: The second (in numeric form, [0, 59]) when the message has been logged.
 	 * - {MILLISECOND}: The millisecond (in numeric form, [0, 999]) when the message has been logged.
+	 * - {MICROSECOND}: The microsecond (in numeric form, [0, 999999]) when the message has been logged.
+	 * - {NANOSECOND}: The nanosecond (in numeric form, [0, 999999999]) when the message has been logged.
+	 * - {EPOCH_NS}: The number of nanoseconds since the epoch when the message has been logged.
 	 * @param time_format: The time format to be set. It can be empty.
 	 * @returns void
 	 * @throws std::bad_alloc: If making the copy of the time format fails.
@@ -162,7 +176,7 @@ public:
 	 * @return The current severity level bitmask (values between 0 and 63).
 	 * @throws N/A.
 	 *************************************************************************************************/
-	[[nodiscard]] std::uint8_t get_severity_level(void) const noexcept;
+	[[nodiscard]] std::uint8_t get_severity_level(void) const noexcept override;
 
 	void set_async_mode(const bool async_mode) noexcept(false);
 
@@ -170,15 +184,198 @@ public:
 
 	[[nodiscard]] std::uint64_t get_lost_logs(void) const noexcept;
 
-private:
 	/** ***********************************************************************************************
-	 * @brief Finds the name of the host. It is thread-safe.
+	 * @brief Sets the clock the messages are being timestamped with. It is **not** thread-safe (the
+	 * messages that are still queued in async mode would be converted with the new clock).
+	 * @param source: The clock to be set.
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void set_timestamp_source(timestamp_source source) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the clock the messages are being timestamped with. It is thread-safe.
+	 * @param void
+	 * @returns The current clock.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] timestamp_source get_timestamp_source(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Sets for how long consecutive identical messages (same call site and arguments) are being
+	 * collapsed. The repetitions are neither formatted nor written, a single "last message repeated N
+	 * times" line being logged when a different message arrives, when the timeout expires (checked by
+	 * a thread of the sink, so a run ending in silence is reported too), when the timeout is changed or
+	 * when the sink is destroyed. It is thread-safe.
+	 * @param timeout: The timeout in milliseconds (0 disables the collapsing).
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void set_collapse_timeout(std::uint32_t timeout) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Gets for how long consecutive identical messages are being collapsed. It is thread-safe.
+	 * @param void
+	 * @returns The timeout in milliseconds (0 if the collapsing is disabled).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::uint32_t get_collapse_timeout(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Sets the filters the messages need to pass before being formatted, replacing the
+	 * previous ones. It is **not** thread-safe.
+	 * @param filters: The filters (empty to let every message of an accepted severity pass).
+	 * @returns void
+	 * @throws std::invalid_argument: If the field of a filter is not known.
+	 * @throws std::bad_alloc: If making the copy of the filters fails.
+	 *************************************************************************************************/
+	void set_filters(const std::vector<sink_filter>& filters) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Gets the filters the messages need to pass before being formatted. It is thread-safe.
+	 * @param void
+	 * @returns The filters, in the order they have been set.
+	 * @throws std::bad_alloc: If the creation of the list fails.
+	 *************************************************************************************************/
+	[[nodiscard]] std::vector<sink_filter> get_filters(void) const noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Checks if a message passes the severity level and then the filters of the sink. Nothing
+	 * is formatted unless a filter matches the content of the message. It is thread-safe.
+	 * @param record: Everything that has been captured when the message has been logged.
+	 * @returns true - the message would be logged.
+	 * @returns false - the message is filtered.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool accepts(const record& record) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Processes a message that has already passed the severity level and the filters (@see
+	 * accepts()), so they are not evaluated again. It is thread-safe.
+	 * @param record: Everything that has been captured when the message has been logged.
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void log_accepted(const record& record) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the messages are formatted the same way as another sink's (same type of sink,
+	 * format, time format and timestamp source), so they can be formatted only once for both. Sinks collapsing the
+	 * repeated messages need to see every record so they are not formatted as any other. It is
+	 * thread-safe.
+	 * @param other: The sink to be compared with.
+	 * @returns true - a line formatted by one sink can be logged by the other.
+	 * @returns false - the sinks format the messages differently.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_formatted_as(const sink_base& other) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Sets the timestamp of the record by reading the clock of the sink (only if it is needed,
+	 * @see is_timestamped()). It is thread-safe.
+	 * @param record: The record to be timestamped.
+	 * @returns The timestamped record.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] record stamp(const record& record) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Formats the message according to the format and time format, appending a new line. It is
+	 * thread-safe.
+	 * @param destination: The string the formatted message will be appended to (its capacity is
+	 * reused, so in steady state no memory is being allocated).
+	 * @param record: Everything that has been captured when the message has been logged (already
+	 * timestamped, @see stamp()).
+	 * @returns void
+	 * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+	 * @throws std::format_error: If an argument can not be formatted (e.g. a negative dynamic width or a
+	 * formatter that throws).
+	 *************************************************************************************************/
+	virtual void format_message(std::string& destination, const record& record) const noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Logs a line that has already been formatted (by this sink or by one formatting the same
+	 * way, @see is_formatted_as()). It is thread-safe.
+	 * @param record: The record the line has been formatted from.
+	 * @param line: The formatted line.
+	 * @param shared_line: Shared copy of the line handed to the async workers. It is created by the
+	 * first sink in async mode that needs it, the following ones only increasing its reference count.
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void dispatch(const record& record, std::string_view line, std::shared_ptr<const std::string>& shared_line) noexcept;
+
+protected:
+	/** ***********************************************************************************************
+	 * @brief Logs the messages that are still queued in async mode and detaches the worker from the
+	 * backend. It needs to be called by the destructor of the concrete sinks, the worker calling their
+	 * methods.
+	 * It is **not** thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void stop_async_worker(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Stops the thread reporting the expired runs, then logs the line reporting the repetitions
+	 * of the run in progress (if any) and ends the run. It needs to be called by the destructor of the
+	 * concrete sinks (before stop_async_worker()), the lines being logged through their methods. It is
+	 * thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void flush_repeats(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the messages need to be timestamped (@see stamp()). By default only if the
+	 * format contains the time. It is thread-safe.
 	 * @param void
-	 * @returns The name of the host or unkown if it could not be found.
-	 * @throws std::bad_alloc: If constructing the result string fails due to memory exhaustion.
+	 * @returns true - the clock is read for every message.
+	 * @returns false - the messages are not timestamped.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] virtual bool is_timestamped(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Writes a batch of lines to a stream with a single call, so the stream is flushed (and the
+	 * system is called) once for the whole batch instead of once per line. It is **not** thread-safe.
+	 * @param stream: The stream the lines are written to.
+	 * @param lines: The lines to be written (they need to be stored back to back).
+	 * @returns The number of lines that have been written entirely, from the beginning of the batch.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] static std::size_t write_lines(FILE* stream, std::span<const sink_line> lines) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Method for concrete sinks to handle a batch of logs taken from the async queue at once.
+	 * The lines are stored back to back. By default they are being logged one by one.
+	 * @param lines: The lines to be logged, in order.
+	 * @returns The number of lines that have been logged, from the beginning of the batch (the others
+	 * are lost).
+	 * @throws N/A.
 	 *************************************************************************************************/
-	[[nodiscard]] static std::string get_host_name(void) noexcept(false);
+	[[nodiscard]] virtual std::size_t log_batch(std::span<const sink_line> lines) noexcept;
 
+	/** ***********************************************************************************************
+	 * @brief Converts the timestamp of the record to wall time. It is thread-safe.
+	 * @param record: The timestamped record (@see stamp()).
+	 * @returns Nanoseconds since the epoch.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::int64_t get_time(const record& record) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Formats the timestamp of the record according to the time format. It is thread-safe.
+	 * @param destination: The string the formatted time will be appended to.
+	 * @param record: The timestamped record (@see stamp()).
+	 * @returns void
+	 * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+	 *************************************************************************************************/
+	void format_time(std::string& destination, const record& record) const noexcept(false);
+
+private:
 	/** ***********************************************************************************************
 	 * @brief Method for concrete sinks to handle logs that have been processed.
 	 * @param severity_bit: Bit indicating the type of message that is being logged (see
@@ -191,43 +388,212 @@ private:
 	virtual bool log(std::uint8_t severity_bit, std::string_view message) noexcept = 0;
 
 	/** ***********************************************************************************************
-	 * @brief Formats the message according to the format and time format. It is thread-safe.
-	 * @param tag: Tag indicating the type of message.
-	 * @param file_path: The path of the file where the log function is being called.
-	 * @param function_name: The name of the function where this call is made.
-	 * @param line: The line where the log function is being called.
-	 * @param message: The message to be logged.
-	 * @returns The message after being formatted.
-	 * @throws std::bad_alloc: If the memory allocation for the formatted message fails.
+	 * @brief Formats the record and delegates the line to the concrete sink. It is thread-safe.
+	 * @param record: Everything that has been captured when the message has been logged.
+	 * @returns true - the message has been logged successfully.
+	 * @returns false - the message has been lost.
+	 * @throws N/A.
 	 *************************************************************************************************/
-	[[nodiscard]] std::string
-	format_message(std::string_view tag, std::string_view file_path, std::string_view function_name, std::int32_t line, std::string_view message) const
-		noexcept(false);
+	[[nodiscard]] bool write(const record& record) noexcept;
 
 	/** ***********************************************************************************************
-	 * @brief Formats the time according to the format. It is thread-safe.
+	 * @brief Logs a record taken from the async queue, formatting it only if it has not been already.
+	 * It is called on the backend thread.
+	 * @param record: The record taken from the queue.
+	 * @returns true - the message has been logged successfully.
+	 * @returns false - the message has been lost.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool write(const stored_record& record) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Logs a batch of records taken from the async queue, formatting the ones that have not
+	 * been already back to back and delegating the whole batch to the concrete sink. It is called on
+	 * the backend thread. The records that can not be formatted or logged are counted as lost here.
+	 * @param records: The records taken from the queue, in order.
+	 * @returns The number of records that have been handled (always the whole batch).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::size_t write(std::span<const stored_record* const> records) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Logs a record, either on the calling thread or through the worker. It is thread-safe.
+	 * @param record: Everything that has been captured when the message has been logged.
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void submit(const record& record) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the record repeats the previous one. When a run of repetitions ends (or lasts
+	 * longer than the timeout) the line reporting it is built, to be logged by the caller once the
+	 * repeat mutex is unlocked. It is thread-safe.
+	 * @param record: Everything that has been captured when the message has been logged.
+	 * @param report: Where the line reporting the repetitions is built (its call site stays nullptr if
+	 * there is nothing to report).
+	 * @returns true - the record is a repetition and it is dropped.
+	 * @returns false - the record needs to be logged.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool collapse(const record& record, hob::log::record& report) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Builds the line reporting the repetitions of the previous message and resets their
+	 * count. The line takes the call site, thread and category saved when the run started. It is
+	 * **not** thread-safe (the repeat mutex needs to be locked).
+	 * @param report: Where the line is built (its call site stays nullptr if there is nothing to
+	 * report).
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void report_repeats(record& report) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Starts the thread reporting the runs whose timeout expires without a new message, if it
+	 * is not running already. It is thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void start_repeat_watcher(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Stops and joins the thread reporting the expired runs, if it is running. It is
+	 * thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void stop_repeat_watcher(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief The loop of the thread reporting the expired runs. It sleeps until the timeout of the run
+	 * in progress expires (or until it is stopped).
 	 * @param void
-	 * @returns The formatted time or a string indicating error getting the current time.
-	 * @throws std::bad_alloc: If the memory alocation of the formatted time fails.
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void watch_repeats(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Delegates a formatted line to the concrete sink, counting its bytes for the call site. It
+	 * is thread-safe.
+	 * @param callsite: The call site the line has been logged from.
+	 * @param line: The formatted line.
+	 * @returns true - the message has been logged successfully.
+	 * @returns false - the message has been lost.
+	 * @throws N/A.
 	 *************************************************************************************************/
-	[[nodiscard]] std::string get_formatted_time(void) const noexcept(false);
+	[[nodiscard]] bool output(const details::callsite& callsite, std::string_view line) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Counts a lost log both for the sink and for the call site. It is thread-safe.
+	 * @param callsite: The call site the message has been logged from.
+	 * @param is_logged: Flag indicating if the message has been logged (nothing is counted if true).
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void count_lost_log(const details::callsite& callsite, bool is_logged) noexcept;
+
 
 private:
 	/** ***********************************************************************************************
-	 * @brief The format of the message to be logged.
+	 * @brief The compiled format of the message to be logged.
 	 *************************************************************************************************/
-	std::string format;
+	message_formatter formatter;
 
 	/** ***********************************************************************************************
-	 * @brief The format of the time information (can be empty if time specifier is not in format).
+	 * @brief The compiled format of the time information (can be empty if time specifier is not in
+	 * format).
 	 *************************************************************************************************/
-	std::string time_format;
+	time_formatter time_format;
 
 	/** ***********************************************************************************************
 	 * @brief Bitmask where bits set to 0 filter messages of that severity.
 	 *************************************************************************************************/
 	std::uint8_t severity_level;
 
+	/** ***********************************************************************************************
+	 * @brief The compiled filters the messages need to pass after the severity level.
+	 *************************************************************************************************/
+	filter_chain filters;
+
+	/** ***********************************************************************************************
+	 * @brief The clock the messages are being timestamped with.
+	 *************************************************************************************************/
+	timestamp_source timestamp_clock;
+
+	/** ***********************************************************************************************
+	 * @brief For how long consecutive identical messages are collapsed in milliseconds (0 if disabled).
+	 *************************************************************************************************/
+	std::atomic<std::uint32_t> collapse_timeout;
+
+	/** ***********************************************************************************************
+	 * @brief Protects the state of the repeated messages.
+	 *************************************************************************************************/
+	std::mutex repeat_mutex;
+
+	/** ***********************************************************************************************
+	 * @brief The call site of the previous message (nullptr if there has been none).
+	 *************************************************************************************************/
+	const details::callsite* repeat_callsite;
+
+	/** ***********************************************************************************************
+	 * @brief The encoded arguments (or the already formatted message) of the previous message.
+	 *************************************************************************************************/
+	std::string repeat_arguments;
+
+	/** ***********************************************************************************************
+	 * @brief The identifier of the thread that logged the previous message.
+	 *************************************************************************************************/
+	std::string repeat_thread_id;
+
+	/** ***********************************************************************************************
+	 * @brief The name of the thread that logged the previous message.
+	 *************************************************************************************************/
+	std::string repeat_thread_name;
+
+	/** ***********************************************************************************************
+	 * @brief The path of the category of the previous message (empty if logged by sink name).
+	 *************************************************************************************************/
+	std::string repeat_category;
+
+	/** ***********************************************************************************************
+	 * @brief How many times the previous message has been repeated since it has been last logged.
+	 *************************************************************************************************/
+	std::uint64_t repeat_count;
+
+	/** ***********************************************************************************************
+	 * @brief When the current run of repetitions started (monotonic, in nanoseconds).
+	 *************************************************************************************************/
+	std::int64_t repeat_start_time;
+
+	/** ***********************************************************************************************
+	 * @brief Wakes the thread reporting the expired runs up when a run gets its first repetition or
+	 * when it needs to stop.
+	 *************************************************************************************************/
+	std::condition_variable repeat_condition;
+
+	/** ***********************************************************************************************
+	 * @brief Flag indicating if the thread reporting the expired runs should keep running.
+	 *************************************************************************************************/
+	bool is_repeat_watched;
+
+	/** ***********************************************************************************************
+	 * @brief The thread reporting the runs whose timeout expires without a new message.
+	 *************************************************************************************************/
+	std::thread repeat_watcher;
+
+	/** ***********************************************************************************************
+	 * @brief The number of slots of the queue allocated when the async mode is enabled.
+	 *************************************************************************************************/
+	std::size_t queue_capacity;
+
+	/** ***********************************************************************************************
+	 * @brief How the messages are being queued when the async mode is enabled.
+	 *************************************************************************************************/
+	queue_layout layout;
+
 	/** ***********************************************************************************************
 	 * @brief TODO
 	 *************************************************************************************************/
@@ -34,9 +34,11 @@
  *****************************************************************************************************/
 
 #include <list>
+#include <vector>
 #include <memory>
 
 #include "sink.hpp"
+#include "sink_base.hpp"
 
 /******************************************************************************************************
  * TYPE DEFINITIONS
@@ -48,7 +50,10 @@ namespace hob::log
 /** ***************************************************************************************************
  * @brief This class provides the composed sink.
  * @details It does not provide a new logging implementation, but instead bundles other sinks so they
- * can be invoked through only 1 call.
+ * can be invoked through only 1 call. The bundled sinks that format the messages the same way are
+ * grouped, so a message is formatted only once per group (when its first sink comes up) and the line
+ * is shared by its sinks. The messages are still handed to the sinks in the order they have been
+ * bundled in.
  *****************************************************************************************************/
 class HOB_LOG_LOCAL sink_composed final : public sink
 {
@@ -64,28 +69,52 @@ public:
 
 	/** ***********************************************************************************************
 	 * @brief Sends a message to the appropiate sinks for them to handle. It is **not** thread-safe.
-	 * @param severity_bit: Bit indicating the type of message that is being logged (see
-	 * hob::log::severity_level).
-	 * @param tag: Tag indicating the type of message.
-	 * @param file_path: The path of the file where the log function is being called.
-	 * @param function_name: The name of the function where this call is made.
-	 * @param line: The line where the log function is being called.
-	 * @param message: The message to be logged.
+	 * @param record: Everything that has been captured when the message has been logged.
 	 * @returns void
 	 * @throws N/A.
 	 *************************************************************************************************/
-	void log(std::uint8_t	  severity_bit,
-			 std::string_view tag,
-			 std::string_view file_path,
-			 std::string_view function_name,
-			 std::int32_t	  line,
-			 std::string_view message) noexcept override;
+	void log(const record& record) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the severities accepted by at least one of the bundled sinks. It is thread-safe.
+	 * @param void
+	 * @returns The union of the severity levels of the bundled sinks.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::uint8_t get_severity_level(void) const noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Groups again the bundled sinks based on how they format the messages. It is **not**
+	 * thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void on_configuration_changed(void) noexcept override;
 
 private:
 	/** ***********************************************************************************************
 	 * @brief The sinks that the messages will be handed to (can **not** be empty).
 	 *************************************************************************************************/
 	const std::list<std::shared_ptr<sink>> sinks;
+
+	/** ***********************************************************************************************
+	 * @brief The bundled sinks that format the messages the same way (@see
+	 * sink_base::is_formatted_as()), each group being non-empty.
+	 *************************************************************************************************/
+	std::vector<std::vector<sink_base*>> groups;
+
+	/** ***********************************************************************************************
+	 * @brief The index of the group of every bundled sink, in the order they have been bundled in
+	 * (SIZE_MAX for the sinks that do not format messages themselves, e.g. other composed sinks).
+	 *************************************************************************************************/
+	std::vector<std::size_t> memberships;
+
+	/** ***********************************************************************************************
+	 * @brief Flag indicating if the groups are valid (if grouping failed the messages are handed to
+	 * every sink separately).
+	 *************************************************************************************************/
+	bool is_grouped;
 };
 
 } /*< namespace hob::log */
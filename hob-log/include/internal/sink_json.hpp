@@ -0,0 +1,143 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file sink_json.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the sink_json class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_SINK_JSON_HPP_
+#define HOB_LOG_INTERNAL_SINK_JSON_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cstdio>
+
+#include "sink_base.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief This class provides the JSON lines sink. Every message is serialized directly into a JSON
+ * object (no intermediate document is being built), the strings being escaped a word at a time.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL sink_json final : public sink_base
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Configures the JSON specific sink parameters.
+	 * @param name: The name of the sink.
+	 * @param configuration: The parameters that will be configured with (the format is not used).
+	 * @throws std::invalid_argument: If the stream is nullptr or severity level is not in the [0, 63]
+	 * interval.
+	 * @throws std::bad_alloc: If making the copy of the name or time format fails.
+	 *************************************************************************************************/
+	sink_json(std::string_view name, const sink_json_configuration& configuration) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Logs the messages that are still queued in async mode before the stream is released.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	~sink_json(void) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Serializes the record as a JSON object followed by a new line. The members are the
+	 * timestamp (nanoseconds since the epoch), the time (only if the time format is not empty), the
+	 * tag, the call site, the thread, the message, the fields (only for structured messages) and the
+	 * context of the thread (only if it is not empty). It is thread-safe.
+	 * @param destination: The string the line will be appended to.
+	 * @param record: Everything that has been captured when the message has been logged (already
+	 * timestamped, @see stamp()).
+	 * @returns void
+	 * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+	 * @throws std::format_error: If an argument can not be formatted (e.g. a negative dynamic width or a
+	 * formatter that throws).
+	 *************************************************************************************************/
+	void format_message(std::string& destination, const record& record) const noexcept(false) override;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief Every line holds the timestamp, so the messages are always timestamped.
+	 * @param void
+	 * @returns true - the clock is read for every message.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_timestamped(void) const noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Writes the line to the stream.
+	 * @param severity_bit: Bit indicating the type of message that is being logged (see
+	 * hob::log::severity_level).
+	 * @param message: The line to be written.
+	 * @returns true - the line has been written successfully.
+	 * @returns false - the log has been lost.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool log(std::uint8_t severity_bit, std::string_view message) noexcept override;
+
+	/** ***********************************************************************************************
+	 * @brief Writes a batch of lines to the stream with a single call.
+	 * @param lines: The lines to be written (stored back to back).
+	 * @returns The number of lines that have been written entirely.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::size_t log_batch(std::span<const sink_line> lines) noexcept override;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The stream the lines are being written to.
+	 *************************************************************************************************/
+	FILE* const stream;
+};
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+namespace json
+{
+
+/** ***************************************************************************************************
+ * @brief Appends a string to the destination, escaping it for a JSON string (without the quotes).
+ * Eight characters are checked at once, the runs that need no escaping being copied in one go. The
+ * characters outside ASCII are copied as they are. It is thread-safe.
+ * @param destination: The string the escaped string will be appended to.
+ * @param string: The string to be escaped.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+HOB_LOG_LOCAL extern void escape(std::string& destination, std::string_view string) noexcept(false);
+
+} /*< namespace json */
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_SINK_JSON_HPP_ */
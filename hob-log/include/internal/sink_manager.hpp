@@ -37,6 +37,7 @@
 #include <list>
 #include <memory>
 #include <cassert>
+#include <cstdint>
 
 #include "types.hpp"
 
@@ -58,6 +59,7 @@ inline constexpr const char* OPERATION_NOT_SUPPORTED_MESSAGE = "The sink does no
  *****************************************************************************************************/
 
 class sink;
+struct record;
 
 /******************************************************************************************************
  * TYPE DEFINITIONS
@@ -95,6 +97,19 @@ public:
 	 *************************************************************************************************/
 	void add_sink(std::string_view sink_name, const sink_terminal_configuration& configuration) noexcept(false);
 
+	/** ***********************************************************************************************
+	 * @brief Adds a JSON sink to the logger. It is **not** thread-safe.
+	 * @param sink_name: The name of the JSON sink (can **not** be empty string).
+	 * @param configuration: The parameters that will be configured with.
+	 * @returns void
+	 * @throws std::logic_error: If the sink name has already been added.
+	 * @throws std::invalid_argument: If the stream is nullptr or severity level is not in the [0, 63]
+	 * interval.
+	 * @throws std::bad_alloc: If the memory allocation of the sink or making the copy of the name
+	 * fails.
+	 *************************************************************************************************/
+	void add_sink(std::string_view sink_name, const sink_json_configuration& configuration) noexcept(false);
+
 	/** ***********************************************************************************************
 	 * @brief Adds a composed sink to the logger. It is **not** thread-safe.
 	 * @param sink_name: The name of the composed sink (can **not** be empty string).
@@ -116,6 +131,18 @@ public:
 	 *************************************************************************************************/
 	void remove_sink(std::string_view sink_name) noexcept;
 
+	/** ***********************************************************************************************
+	 * @brief Notifies the sinks that the configuration has been changed (so the composed sinks can
+	 * group again their sinks) and recomputes the mask of severities accepted by at least one sink,
+	 * which is checked by the logging macros before doing any work. The routing tables of the
+	 * categories are rebuilt for the new indices and severity levels of the sinks. This needs to be
+	 * called after the configuration of a sink has been changed. It is **not** thread-safe.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void on_configuration_changed(void) const noexcept;
+
 	/** ***********************************************************************************************
 	 * @brief Checks if the name of a sink is valid. It is thread-safe.
 	 * @param sink_name: The name of the sink to be checked.
@@ -125,6 +152,17 @@ public:
 	 *************************************************************************************************/
 	[[nodiscard]] bool is_sink_valid(std::string_view sink_name) const noexcept;
 
+	/** ***********************************************************************************************
+	 * @brief Sends a record to the sinks of a routing table (@see category.hpp), visiting only the
+	 * bits that are set. The indices of sinks that have been removed meanwhile are skipped. It is
+	 * thread-safe.
+	 * @param sinks: The bitset of the indices of the sinks.
+	 * @param record: Everything that has been captured when the message has been logged.
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void log(std::uint64_t sinks, const record& record) noexcept;
+
 	/** ***********************************************************************************************
 	 * @brief Sets the name of the default sink that will be used when logging with default macros. It
 	 * is **not** thread-safe.
@@ -58,6 +58,13 @@ public:
 	 *************************************************************************************************/
 	sink_terminal(std::string_view name, const sink_terminal_configuration& configuration) noexcept(false);
 
+	/** ***********************************************************************************************
+	 * @brief Logs the messages that are still queued in async mode before the stream is released.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	~sink_terminal(void) noexcept override;
+
 	/** ***********************************************************************************************
 	 * @brief Sets a new stream. It is **not** thread-safe.
 	 * @param stream: The stream to be set.
@@ -103,6 +110,15 @@ private:
 	 *************************************************************************************************/
 	[[nodiscard]] bool log(std::uint8_t severity_bit, std::string_view message) noexcept override;
 
+	/** ***********************************************************************************************
+	 * @brief Prints a batch of messages to the terminal with a single call, the escape sequences of
+	 * the colors being placed between them. It is **not** thread-safe.
+	 * @param lines: The messages to be logged (stored back to back).
+	 * @returns The number of messages that have been logged entirely.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::size_t log_batch(std::span<const sink_line> lines) noexcept override;
+
 	/** ***********************************************************************************************
 	 * @brief Changes the color of the terminal output depending on the severity level of the log. (0
 	 * will restore the color to its default).
@@ -133,12 +149,13 @@ class HOB_LOG_LOCAL color final
 public:
 	/** ***********************************************************************************************
 	 * @brief Changes the terminal text color based on the severity of the log.
+	 * @param stream: The stream the escape sequences are written to.
 	 * @param color_enabled: Flag indicating if the terminal text color needs to be changed.
 	 * @param severity_bit: Bit indicating the type of message that is being logged (see
 	 * hob::log::severity_level).
 	 * @throws N/A.
 	 *************************************************************************************************/
-	color(bool color_enabled, std::uint8_t severity_bit) noexcept;
+	color(FILE* stream, bool color_enabled, std::uint8_t severity_bit) noexcept;
 
 	/** ***********************************************************************************************
 	 * @brief Restores the color to the default one (only if it was changed).
@@ -148,6 +165,11 @@ public:
 	~color(void) noexcept;
 
 private:
+	/** ***********************************************************************************************
+	 * @brief The stream the escape sequences are written to.
+	 *************************************************************************************************/
+	FILE* const stream;
+
 	/** ***********************************************************************************************
 	 * @brief Stored flag to not restore color in destructor if it was not changed.
 	 *************************************************************************************************/
@@ -0,0 +1,75 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file thread_info.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the cache of the thread identity fields.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_THREAD_INFO_HPP_
+#define HOB_LOG_INTERNAL_THREAD_INFO_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string_view>
+
+#include "details/visibility.hpp"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+namespace hob::log::thread_info
+{
+
+/** ***********************************************************************************************
+ * @brief Gets the identifier of the calling thread. It is rendered only at the first call made by
+ * every thread. It is thread-safe.
+ * @param void
+ * @returns The identifier of the calling thread.
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::string_view get_thread_id(void) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Gets the name of the calling thread. It is thread-safe.
+ * @param void
+ * @returns The name of the calling thread or its identifier if a name has not been set.
+ * @throws N/A.
+ *************************************************************************************************/
+HOB_LOG_LOCAL [[nodiscard]] extern std::string_view get_thread_name(void) noexcept;
+
+/** ***********************************************************************************************
+ * @brief Sets the name of the calling thread. The name is also given to the kernel (truncated to 15
+ * characters) so it is visible in tools like perf or top. It is thread-safe.
+ * @param name: The name of the calling thread (empty string to reset it to the identifier).
+ * @returns void
+ * @throws std::bad_alloc: If making the copy of the name fails.
+ *************************************************************************************************/
+HOB_LOG_LOCAL extern void set_thread_name(std::string_view name) noexcept(false);
+
+} /*< namespace hob::log::thread_info */
+
+#endif /*< HOB_LOG_INTERNAL_THREAD_INFO_HPP_ */
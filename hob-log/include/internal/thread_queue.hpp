@@ -0,0 +1,238 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file thread_queue.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the thread_queue class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_THREAD_QUEUE_HPP_
+#define HOB_LOG_INTERNAL_THREAD_QUEUE_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <memory>
+#include <span>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#include "details/visibility.hpp"
+#include "log_queue.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief Bounded wait-free queue for one supplier thread and one consumer thread.
+ * @details Every thread logging to a sink with per-thread queues gets its own (@see merging_queue).
+ * The supplier only writes the end position and the consumer only the beginning one, each keeping a
+ * cached copy of the other's so the shared cache lines are read only when the cached copy says the
+ * queue is full (or empty). Every record carries the key it is merged by. A full queue does not block
+ * the supplier, the message being lost instead.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL thread_queue final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Allocates the slots of the queue.
+	 * @param capacity: The number of slots (rounded up to a power of 2, at least 2).
+	 * @throws std::bad_alloc: If the allocation of the slots fails.
+	 *************************************************************************************************/
+	explicit thread_queue(std::size_t capacity) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the queue has any message stored in it. It needs to be called by the consumer.
+	 * @param void
+	 * @returns true - queue is empty.
+	 * @returns false - queue has at least 1 message.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_empty(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Copies the log record at the end of the queue. It needs to be called by the supplier.
+	 * @param record: The record of the log.
+	 * @param key: The key the record is merged by (its timestamp).
+	 * @returns true - the log has been emplaced successfully.
+	 * @returns false - the log has been lost (the queue is full or the copy failed).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool emplace(const record& record, std::uint64_t key) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Places a line that has already been formatted at the end of the queue. It needs to be
+	 * called by the supplier.
+	 * @param callsite: Where the message has been logged (static storage).
+	 * @param line: The formatted line (shared, it is not copied).
+	 * @param key: The key the line is merged by (its timestamp).
+	 * @returns true - the log has been emplaced successfully.
+	 * @returns false - the log has been lost (the queue is full).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool emplace(const details::callsite* callsite, const std::shared_ptr<const std::string>& line, std::uint64_t key) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the record at the beginning of the queue, without removing it. It needs to be called
+	 * by the consumer.
+	 * @param void
+	 * @returns The first record stored (valid until pop() is called) or nullptr if the queue is empty.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] const stored_record* front(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the key of the record returned by front(). It needs to be called by the consumer.
+	 * @param void
+	 * @returns The key the record is merged by.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::uint64_t get_front_key(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Removes the record returned by front(), handing its slot back to the supplier. It needs
+	 * to be called by the consumer.
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void pop(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Gets the records at the beginning of the queue whose keys do not exceed a limit, without
+	 * removing them. It needs to be called by the consumer.
+	 * @param records: Where the records are stored (its size is the maximum number of records).
+	 * @param last_key: The greatest key a record can have to be part of the range.
+	 * @returns The number of records stored (valid until pop() is called).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::size_t front(std::span<const stored_record*> records, std::uint64_t last_key) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Removes the records returned by front(), handing their slots back to the supplier at
+	 * once. It needs to be called by the consumer.
+	 * @param count: The number of records returned by front().
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void pop(std::size_t count) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Marks that the supplier thread has exited, so the queue can be released once it has been
+	 * emptied. It needs to be called by the supplier, after its last emplace().
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void close(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the supplier thread has exited. It is thread-safe.
+	 * @param void
+	 * @returns true - no record will be emplaced anymore.
+	 * @returns false - the supplier thread is still running.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_closed(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Marks that the consumer is gone (the sink has been removed or left the async mode), so
+	 * the supplier can release the queue. It needs to be called by the consumer, after its last pop().
+	 * @param void
+	 * @returns void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	void abandon(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the consumer is gone. It is thread-safe.
+	 * @param void
+	 * @returns true - no record will be consumed anymore.
+	 * @returns false - the queue is still being consumed.
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_abandoned(void) const noexcept;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief A preallocated slot, on its own cache lines.
+	 *************************************************************************************************/
+	struct alignas(CACHE_LINE_SIZE) slot final
+	{
+		std::uint64_t key;	  /**< The key the record is merged by.			*/
+		stored_record record; /**< The record, its storage being reused.	*/
+	};
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The slots of the queue (a power of 2, so positions are mapped to them by a mask).
+	 *************************************************************************************************/
+	std::unique_ptr<slot[]> slots;
+
+	/** ***********************************************************************************************
+	 * @brief The number of slots minus one.
+	 *************************************************************************************************/
+	std::uint64_t mask;
+
+	/** ***********************************************************************************************
+	 * @brief The position the supplier emplaces the next record at (written by the supplier).
+	 *************************************************************************************************/
+	alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> end_position;
+
+	/** ***********************************************************************************************
+	 * @brief The beginning position, as last seen by the supplier.
+	 *************************************************************************************************/
+	std::uint64_t cached_begin_position;
+
+	/** ***********************************************************************************************
+	 * @brief The position of the record at the beginning of the queue (written by the consumer).
+	 *************************************************************************************************/
+	alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> begin_position;
+
+	/** ***********************************************************************************************
+	 * @brief The end position, as last seen by the consumer.
+	 *************************************************************************************************/
+	std::uint64_t cached_end_position;
+
+	/** ***********************************************************************************************
+	 * @brief Flag indicating that the supplier thread has exited.
+	 *************************************************************************************************/
+	alignas(CACHE_LINE_SIZE) std::atomic<bool> is_supplier_gone;
+
+	/** ***********************************************************************************************
+	 * @brief Flag indicating that the consumer is gone.
+	 *************************************************************************************************/
+	std::atomic<bool> is_consumer_gone;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_THREAD_QUEUE_HPP_ */
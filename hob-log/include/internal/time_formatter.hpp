@@ -0,0 +1,169 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file time_formatter.hpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This header defines the time_formatter class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef HOB_LOG_INTERNAL_TIME_FORMATTER_HPP_
+#define HOB_LOG_INTERNAL_TIME_FORMATTER_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "details/visibility.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief This class compiles a time format into a sequence of tokens.
+ * @details Everything that does not change during a second (calendar fields and literals) is rendered
+ * once per second and per thread, then reused. Only the sub-second fields are being appended for
+ * every message. The calendar is computed arithmetically from a cached UTC offset, so the libc time
+ * zone lock is taken at most once every 15 minutes per thread.
+ *****************************************************************************************************/
+class HOB_LOG_LOCAL time_formatter final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Enumerates the operations that a time format can be compiled into.
+	 *************************************************************************************************/
+	enum class field : std::uint8_t
+	{
+		LITERAL,		  /**< Text copied as it is from the format. */
+		YEAR,			  /**< {YEAR} placeholder.					 */
+		MONTH_NUMERIC,	  /**< {MONTH:numeric} placeholder.			 */
+		MONTH_LONG,		  /**< {MONTH:long} placeholder.			 */
+		MONTH_SHORT,	  /**< {MONTH:short} placeholder.			 */
+		DAY_YEAR,		  /**< {DAY_YEAR} placeholder.				 */
+		DAY_MONTH,		  /**< {DAY_MONTH} placeholder.				 */
+		DAY_WEEK_NUMERIC, /**< {DAY_WEEK:numeric} placeholder.		 */
+		DAY_WEEK_LONG,	  /**< {DAY_WEEK:long} placeholder.			 */
+		DAY_WEEK_SHORT,	  /**< {DAY_WEEK:short} placeholder.		 */
+		HOUR_24,		  /**< {HOUR:24} placeholder.				 */
+		HOUR_12,		  /**< {HOUR:12} placeholder.				 */
+		MERIDIEM,		  /**< {MERIDIEM} placeholder.				 */
+		MINUTE,			  /**< {MINUTE} placeholder.				 */
+		SECOND,			  /**< {SECOND} placeholder.				 */
+		MILLISECOND,	  /**< {MILLISECOND} placeholder.			 */
+		MICROSECOND,	  /**< {MICROSECOND} placeholder.			 */
+		NANOSECOND,		  /**< {NANOSECOND} placeholder.			 */
+		EPOCH_NS		  /**< {EPOCH_NS} placeholder.				 */
+	};
+
+	/** ***********************************************************************************************
+	 * @brief Creates an empty formatter (formats nothing until a time format is compiled).
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	time_formatter(void) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Compiles a new time format, replacing the previous one. It is **not** thread-safe.
+	 * @param format: The time format to be compiled (can be empty).
+	 * @returns void
+	 * @throws std::bad_alloc: If making the copy of the time format or of the tokens fails.
+	 *************************************************************************************************/
+	void compile(std::string_view format) noexcept(false);
+
+	/** ***********************************************************************************************
+	 * @brief Gets the time format that has been compiled. It is thread-safe.
+	 * @param void
+	 * @returns The current time format (can be empty).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	[[nodiscard]] std::string_view get_format(void) const noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Appends the formatted time to the destination. It is thread-safe.
+	 * @param destination: The string the formatted time will be appended to.
+	 * @param timestamp: The number of nanoseconds elapsed since the epoch.
+	 * @returns void
+	 * @throws std::bad_alloc: If the destination or the cache needs to grow and the memory
+	 * reallocation fails.
+	 *************************************************************************************************/
+	void format(std::string& destination, std::int64_t timestamp) const noexcept(false);
+
+private:
+	/** ***********************************************************************************************
+	 * @brief A compiled operation (literal spans are stored as offsets so the copies stay valid).
+	 *************************************************************************************************/
+	struct token final
+	{
+		field		type;	/**< The operation of the token.									*/
+		std::size_t offset; /**< The index of the literal inside the format (only for literals). */
+		std::size_t length; /**< The length of the literal inside the format (only for literals). */
+	};
+
+	/** ***********************************************************************************************
+	 * @brief The rendering of a format for a given second, kept by every thread.
+	 *************************************************************************************************/
+	struct cache final
+	{
+		std::uint64_t							   identifier; /**< Identifier of the compiled format that has been rendered. */
+		std::int64_t							   second;	   /**< The second since the epoch that has been rendered.		  */
+		std::string								   rendered;   /**< The format with all the second-stable fields rendered.	  */
+		std::vector<std::pair<std::size_t, field>> patches;	   /**< Positions inside the rendering of the sub-second fields.  */
+		std::uint64_t							   last_use;   /**< When the entry has been used last (per thread counter).	  */
+	};
+
+	/** ***********************************************************************************************
+	 * @brief Renders the second-stable part of the format into a cache entry. It is thread-safe.
+	 * @param entry: The cache entry that will hold the rendering.
+	 * @param second: The second since the epoch to be rendered.
+	 * @returns void
+	 * @throws std::bad_alloc: If the cache entry needs to grow and the memory reallocation fails.
+	 *************************************************************************************************/
+	void render(cache& entry, std::int64_t second) const noexcept(false);
+
+private:
+	/** ***********************************************************************************************
+	 * @brief The time format as it has been given.
+	 *************************************************************************************************/
+	std::string source;
+
+	/** ***********************************************************************************************
+	 * @brief The operations that the time format has been compiled into.
+	 *************************************************************************************************/
+	std::vector<token> tokens;
+
+	/** ***********************************************************************************************
+	 * @brief Process-wide unique identifier of the compiled format, used to validate cache entries.
+	 *************************************************************************************************/
+	std::uint64_t identifier;
+};
+
+} /*< namespace hob::log */
+
+#endif /*< HOB_LOG_INTERNAL_TIME_FORMATTER_HPP_ */
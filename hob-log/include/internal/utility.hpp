@@ -77,24 +77,12 @@ namespace hob::log::utility
 {
 
 /** ***********************************************************************************************
- * @brief Replaces a placeholder inside a format string. It is thread-safe.
- * @param destination: The string to be formatted.
- * @param placeholder: The substring that will be substituted inside the format string.
- * @param replacement: The string that will replace the placeholder.
- * @returns void
- * @throws std::bad_alloc: If the replacement is larger than the placeholder and the memory
- * reallocation fails.
- *************************************************************************************************/
-HOB_LOG_LOCAL extern void replace_placeholder(std::string& destination, std::string_view placeholder, std::string_view replacement) noexcept(false);
-
-/** ***********************************************************************************************
- * @brief Gets information about the current time. It is thread-safe.
+ * @brief Gets the current time. It is thread-safe.
  * @param void
- * @returns Firsts in the pair is structure containing info about year, month, day, etc. (can be
- * nullptr in case of failure) and the second is the milliseconds.
+ * @returns The number of nanoseconds elapsed since the epoch.
  * @throws N/A.
  *************************************************************************************************/
-HOB_LOG_LOCAL [[nodiscard]] extern std::pair<std::tm*, std::int64_t> get_time(void) noexcept;
+HOB_LOG_LOCAL [[nodiscard]] extern std::int64_t get_timestamp(void) noexcept;
 
 } /*< namespace hob::log::utility */
 
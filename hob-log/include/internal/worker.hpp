@@ -34,9 +34,14 @@
  *****************************************************************************************************/
 
 #include <string>
-#include <thread>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <span>
+#include <cstddef>
 
-#include "message_queue.hpp"
+#include "log_queue.hpp"
+#include "notifier.hpp"
 
 /******************************************************************************************************
  * TYPE DEFINITIONS
@@ -48,64 +53,89 @@ namespace hob::log
 /** ***************************************************************************************************
  * @brief This class provides an asynchronous logging mechanism.
  * @details The worker class accepts log messages from the caller thread, queues them, and processes
- * them on a separate worker thread, ensuring that the caller thread is not blocked while waiting for
- * the logging operation to complete.
+ * them on a backend thread, ensuring that the caller thread is not blocked while waiting for the
+ * logging operation to complete. The worker does not own a thread, the backend threads being shared
+ * by all the async sinks (@see backend).
  *****************************************************************************************************/
 class HOB_LOG_LOCAL worker final
 {
 public:
 	/** ***********************************************************************************************
-	 * @brief Type alias for a callback function used to handle log messages.
-	 * @param severity_bit The severity level of the log message.
-	 * @param message The log message to be processed.
-	 * @returns true - the message has been logged successfully.
-	 * @returns false - the log has been lost.
+	 * @brief Type alias for a callback function used to handle batches of log messages.
+	 * @param records The records of the logs to be formatted (if they have not been already) and
+	 * processed, in order.
+	 * @returns The number of messages that have been logged, from the beginning of the batch (the
+	 * others are lost).
 	 * @throws N/A.
 	 *************************************************************************************************/
-	using callback = std::function<bool(std::uint8_t, std::string&&)>;
+	using callback = std::function<std::size_t(std::span<const stored_record* const>)>;
 
 	/** ***********************************************************************************************
-	 * @brief Creates the worker thread that waits for messages to be inserted into the queue.
+	 * @brief Attaches the worker to the backend, which starts serving its queue.
 	 * @param callback: The function that will be called to handle the logging of the message on the
-	 * working thread.
+	 * backend thread.
 	 * @param lost_logs_count: Reference to the counter of lost logs due to unrecoverable errors.
+	 * @param queue: The queue the messages are being handed to the backend thread through (can not be
+	 * nullptr).
+	 * @throws std::bad_alloc: If attaching the worker to the backend fails.
+	 * @throws std::system_error: If starting the backend threads fails.
 	 *************************************************************************************************/
-	worker(callback&& callback, std::atomic<std::uint64_t>& lost_logs_count) noexcept;
+	worker(callback&& callback, std::atomic<std::uint64_t>& lost_logs_count, std::unique_ptr<log_queue> queue) noexcept(false);
 
 	/** ***********************************************************************************************
-	 * @brief Logs the buffered messages and joins the working thread.
+	 * @brief Detaches the worker from the backend and logs the buffered messages.
 	 * @param void
 	 * @throws N/A.
 	 *************************************************************************************************/
 	~worker(void) noexcept;
 
 	/** ***********************************************************************************************
-	 * @brief Logs the message through the given callback on a separate thread. It is thread-safe.
-	 * @param severity_bit: Bit indicating the type of message that is being logged (see
-	 * hob::log::severity_level).
-	 * @param message: The message to be logged.
+	 * @brief Logs the message through the given callback on the backend thread. It is thread-safe.
+	 * Only a copy of the record is being made on the calling thread.
+	 * @param record: The record of the log to be copied into the queue.
 	 * @returns true - the message has been logged successfully.
 	 * @returns false - the log has been lost.
 	 *************************************************************************************************/
-	[[nodiscard]] bool log(std::uint8_t severity_bit, std::string&& message) noexcept;
+	[[nodiscard]] bool log(const record& record) noexcept;
 
-private:
 	/** ***********************************************************************************************
-	 * @brief Logs the message from the queue through the given callback. It is **not** thread-safe.
-	 * @param void
-	 * @returns void
+	 * @brief Logs a line that has already been formatted through the given callback on the backend
+	 * thread. It is thread-safe.
+	 * @param callsite: Where the message has been logged (static storage).
+	 * @param line: The formatted line (shared with the other sinks, it is not copied).
+	 * @returns true - the message has been logged successfully.
+	 * @returns false - the log has been lost.
+	 *************************************************************************************************/
+	[[nodiscard]] bool log(const details::callsite* callsite, const std::shared_ptr<const std::string>& line) noexcept;
+
+	/** ***********************************************************************************************
+	 * @brief Logs the messages from the queue through the given callback, without waiting. The pending
+	 * messages are being taken in batches, so the callback can output each batch at once. It needs to
+	 * be called by the backend thread serving the worker.
+	 * @param budget: The maximum number of messages to be logged.
+	 * @returns The number of messages that have been consumed.
 	 * @throws N/A.
 	 *************************************************************************************************/
-	void log_messages(void) noexcept;
+	[[nodiscard]] std::size_t log_messages(std::size_t budget) noexcept;
 
 	/** ***********************************************************************************************
-	 * @brief Logs a message from the queue and waits if the queue is empty until a message is being
-	 * inserted. It is **not** thread-safe.
+	 * @brief Checks if there are messages waiting to be logged. It needs to be called by the backend
+	 * thread serving the worker.
 	 * @param void
-	 * @returns void
+	 * @returns true - the queue is empty.
+	 * @returns false - the queue has at least 1 message.
 	 * @throws N/A.
 	 *************************************************************************************************/
-	void log_message(void) noexcept;
+	[[nodiscard]] bool is_empty(void) const noexcept;
+
+private:
+	/** ***********************************************************************************************
+	 * @brief Logs a batch of messages from the queue if there are any. It is **not** thread-safe.
+	 * @param capacity: The maximum number of messages in the batch.
+	 * @returns The number of messages that have been consumed (0 if the queue is empty).
+	 * @throws N/A.
+	 *************************************************************************************************/
+	std::size_t log_batch(std::size_t capacity) noexcept;
 
 private:
 	/** ***********************************************************************************************
@@ -119,19 +149,15 @@ private:
 	std::atomic<std::uint64_t>& lost_logs_count;
 
 	/** ***********************************************************************************************
-	 * @brief The thread-safe queue that holds the pending message to be logged.
-	 *************************************************************************************************/
-	message_queue queue;
-
-	/** ***********************************************************************************************
-	 * @brief The flag indicating if the worker thread should keep running.
+	 * @brief The lock-free queue that holds the pending message to be logged.
 	 *************************************************************************************************/
-	bool is_working;
+	std::unique_ptr<log_queue> queue;
 
 	/** ***********************************************************************************************
-	 * @brief The worker thread on which the message are being logged.
+	 * @brief Wakes the backend thread serving the worker up (declared last, the worker being served as
+	 * soon as it is attached).
 	 *************************************************************************************************/
-	std::thread thread;
+	notifier& backend_notifier;
 };
 
 } /*< namespace hob::log */
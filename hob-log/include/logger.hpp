@@ -26,6 +26,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 
 #include "details/internal.hpp"
 #include "details/strip.hpp"
@@ -47,6 +48,94 @@
  *****************************************************************************************************/
 #define HOB_LOG_FATAL(sink_name, format, ...) HOB_LOG_DETAILS_FATAL(sink_name, format, ##__VA_ARGS__)
 
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message only once every n calls of this call site (the first call being
+ * logged). The dropped calls return before the arguments are evaluated, their number being reported
+ * in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The sampling period.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_EVERY_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::FATAL, hob::log::LOG_TAG_FATAL, every_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message only for the first n calls of this call site. The dropped calls
+ * return before the arguments are evaluated.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The number of calls to be logged.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_FIRST_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::FATAL, hob::log::LOG_TAG_FATAL, first_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message at most once per interval for this call site. The dropped calls
+ * return before the arguments are evaluated, their number being reported in the next logged message
+ * of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param milliseconds: The length of the interval.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_EVERY_MS(sink_name, milliseconds, format, ...)                                                                                               \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::FATAL, hob::log::LOG_TAG_FATAL, every_interval, (milliseconds), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message as long as this call site has tokens left in its bucket, which
+ * is refilled at a constant rate. The dropped calls return before the arguments are evaluated,
+ * their number being reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param rate: The number of tokens added every second.
+ * @param burst: The capacity of the bucket (the number of calls that can be logged at once).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_TOKEN_BUCKET(sink_name, rate, burst, format, ...)                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::FATAL, hob::log::LOG_TAG_FATAL, token_bucket, (rate, burst), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message (system is unusable or application is crashing) with structured
+ * key-value fields. The message is not formatted, the fields being encoded so that every sink renders
+ * them its own way (e.g. "key=value" by the terminal sink, members of a JSON object by the JSON sink).
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The keys and the values (booleans, numbers or strings) of the fields, alternating
+ * (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_KV(sink_name, message, ...)                                                                                                                  \
+	HOB_LOG_DETAILS_FIELDS(sink_name, hob::log::severity_level::FATAL, hob::log::LOG_TAG_FATAL, message, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message (system is unusable or application is crashing) under a category,
+ * to the sinks the category is routed to. The check is a single load, the severity level of the
+ * category being resolved when it is configured.
+ * @param category: The handle of the category (see hob::log::get_category()).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_FATAL_CATEGORY(category, format, ...)                                                                                                              \
+	HOB_LOG_DETAILS_CATEGORY(category, hob::log::severity_level::FATAL, hob::log::LOG_TAG_FATAL, format, ##__VA_ARGS__)
+
 #endif /*< HOB_LOG_STRIP_FATAL */
 
 #ifndef HOB_LOG_STRIP_ERROR
@@ -62,6 +151,94 @@
  *****************************************************************************************************/
 #define HOB_LOG_ERROR(sink_name, format, ...) HOB_LOG_DETAILS_ERROR(sink_name, format, ##__VA_ARGS__)
 
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message only once every n calls of this call site (the first call
+ * being logged). The dropped calls return before the arguments are evaluated, their number being
+ * reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The sampling period.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_EVERY_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::ERROR, hob::log::LOG_TAG_ERROR, every_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message only for the first n calls of this call site. The dropped
+ * calls return before the arguments are evaluated.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The number of calls to be logged.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_FIRST_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::ERROR, hob::log::LOG_TAG_ERROR, first_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message at most once per interval for this call site. The dropped
+ * calls return before the arguments are evaluated, their number being reported in the next logged
+ * message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param milliseconds: The length of the interval.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_EVERY_MS(sink_name, milliseconds, format, ...)                                                                                               \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::ERROR, hob::log::LOG_TAG_ERROR, every_interval, (milliseconds), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message as long as this call site has tokens left in its bucket,
+ * which is refilled at a constant rate. The dropped calls return before the arguments are
+ * evaluated, their number being reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param rate: The number of tokens added every second.
+ * @param burst: The capacity of the bucket (the number of calls that can be logged at once).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_TOKEN_BUCKET(sink_name, rate, burst, format, ...)                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::ERROR, hob::log::LOG_TAG_ERROR, token_bucket, (rate, burst), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message (system or application is still usable) with structured key-
+ * value fields. The message is not formatted, the fields being encoded so that every sink renders them
+ * its own way (e.g. "key=value" by the terminal sink, members of a JSON object by the JSON sink).
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The keys and the values (booleans, numbers or strings) of the fields, alternating
+ * (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_KV(sink_name, message, ...)                                                                                                                  \
+	HOB_LOG_DETAILS_FIELDS(sink_name, hob::log::severity_level::ERROR, hob::log::LOG_TAG_ERROR, message, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message (system or application is still usable) under a category, to
+ * the sinks the category is routed to. The check is a single load, the severity level of the category
+ * being resolved when it is configured.
+ * @param category: The handle of the category (see hob::log::get_category()).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_ERROR_CATEGORY(category, format, ...)                                                                                                              \
+	HOB_LOG_DETAILS_CATEGORY(category, hob::log::severity_level::ERROR, hob::log::LOG_TAG_ERROR, format, ##__VA_ARGS__)
+
 #endif /*< HOB_LOG_STRIP_ERROR */
 
 #ifndef HOB_LOG_STRIP_WARN
@@ -77,6 +254,94 @@
  *****************************************************************************************************/
 #define HOB_LOG_WARN(sink_name, format, ...) HOB_LOG_DETAILS_WARN(sink_name, format, ##__VA_ARGS__)
 
+/** ***************************************************************************************************
+ * @brief Logs a warning message only once every n calls of this call site (the first call being
+ * logged). The dropped calls return before the arguments are evaluated, their number being reported
+ * in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The sampling period.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_EVERY_N(sink_name, n, format, ...)                                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::WARN, hob::log::LOG_TAG_WARN, every_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message only for the first n calls of this call site. The dropped calls
+ * return before the arguments are evaluated.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The number of calls to be logged.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_FIRST_N(sink_name, n, format, ...)                                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::WARN, hob::log::LOG_TAG_WARN, first_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message at most once per interval for this call site. The dropped calls
+ * return before the arguments are evaluated, their number being reported in the next logged message
+ * of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param milliseconds: The length of the interval.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_EVERY_MS(sink_name, milliseconds, format, ...)                                                                                                \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::WARN, hob::log::LOG_TAG_WARN, every_interval, (milliseconds), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message as long as this call site has tokens left in its bucket, which is
+ * refilled at a constant rate. The dropped calls return before the arguments are evaluated, their
+ * number being reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param rate: The number of tokens added every second.
+ * @param burst: The capacity of the bucket (the number of calls that can be logged at once).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_TOKEN_BUCKET(sink_name, rate, burst, format, ...)                                                                                             \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::WARN, hob::log::LOG_TAG_WARN, token_bucket, (rate, burst), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message (something unusual that might require attention) with structured key-
+ * value fields. The message is not formatted, the fields being encoded so that every sink renders them
+ * its own way (e.g. "key=value" by the terminal sink, members of a JSON object by the JSON sink).
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The keys and the values (booleans, numbers or strings) of the fields, alternating
+ * (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_KV(sink_name, message, ...)                                                                                                                   \
+	HOB_LOG_DETAILS_FIELDS(sink_name, hob::log::severity_level::WARN, hob::log::LOG_TAG_WARN, message, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message (something unusual that might require attention) under a category, to
+ * the sinks the category is routed to. The check is a single load, the severity level of the category
+ * being resolved when it is configured.
+ * @param category: The handle of the category (see hob::log::get_category()).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_WARN_CATEGORY(category, format, ...)                                                                                                               \
+	HOB_LOG_DETAILS_CATEGORY(category, hob::log::severity_level::WARN, hob::log::LOG_TAG_WARN, format, ##__VA_ARGS__)
+
 #endif /*< HOB_LOG_STRIP_WARN */
 
 #ifndef HOB_LOG_STRIP_INFO
@@ -92,6 +357,93 @@
  *****************************************************************************************************/
 #define HOB_LOG_INFO(sink_name, format, ...) HOB_LOG_DETAILS_INFO(sink_name, format, ##__VA_ARGS__)
 
+/** ***************************************************************************************************
+ * @brief Logs an information message only once every n calls of this call site (the first call
+ * being logged). The dropped calls return before the arguments are evaluated, their number being
+ * reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The sampling period.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_EVERY_N(sink_name, n, format, ...)                                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::INFO, hob::log::LOG_TAG_INFO, every_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message only for the first n calls of this call site. The dropped
+ * calls return before the arguments are evaluated.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The number of calls to be logged.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_FIRST_N(sink_name, n, format, ...)                                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::INFO, hob::log::LOG_TAG_INFO, first_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message at most once per interval for this call site. The dropped
+ * calls return before the arguments are evaluated, their number being reported in the next logged
+ * message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param milliseconds: The length of the interval.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_EVERY_MS(sink_name, milliseconds, format, ...)                                                                                                \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::INFO, hob::log::LOG_TAG_INFO, every_interval, (milliseconds), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message as long as this call site has tokens left in its bucket, which
+ * is refilled at a constant rate. The dropped calls return before the arguments are evaluated,
+ * their number being reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param rate: The number of tokens added every second.
+ * @param burst: The capacity of the bucket (the number of calls that can be logged at once).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_TOKEN_BUCKET(sink_name, rate, burst, format, ...)                                                                                             \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::INFO, hob::log::LOG_TAG_INFO, token_bucket, (rate, burst), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message with structured key-value fields. The message is not formatted,
+ * the fields being encoded so that every sink renders them its own way (e.g. "key=value" by the
+ * terminal sink, members of a JSON object by the JSON sink).
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The keys and the values (booleans, numbers or strings) of the fields, alternating
+ * (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_KV(sink_name, message, ...)                                                                                                                   \
+	HOB_LOG_DETAILS_FIELDS(sink_name, hob::log::severity_level::INFO, hob::log::LOG_TAG_INFO, message, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message under a category, to the sinks the category is routed to. The
+ * check is a single load, the severity level of the category being resolved when it is configured.
+ * @param category: The handle of the category (see hob::log::get_category()).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_INFO_CATEGORY(category, format, ...)                                                                                                               \
+	HOB_LOG_DETAILS_CATEGORY(category, hob::log::severity_level::INFO, hob::log::LOG_TAG_INFO, format, ##__VA_ARGS__)
+
 #endif /*< HOB_LOG_STRIP_INFO */
 
 #ifndef HOB_LOG_STRIP_DEBUG
@@ -107,6 +459,94 @@
  *****************************************************************************************************/
 #define HOB_LOG_DEBUG(sink_name, format, ...) HOB_LOG_DETAILS_DEBUG(sink_name, format, ##__VA_ARGS__)
 
+/** ***************************************************************************************************
+ * @brief Logs a debugging message only once every n calls of this call site (the first call being
+ * logged). The dropped calls return before the arguments are evaluated, their number being reported
+ * in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The sampling period.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_EVERY_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::DEBUG, hob::log::LOG_TAG_DEBUG, every_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a debugging message only for the first n calls of this call site. The dropped calls
+ * return before the arguments are evaluated.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The number of calls to be logged.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_FIRST_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::DEBUG, hob::log::LOG_TAG_DEBUG, first_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a debugging message at most once per interval for this call site. The dropped calls
+ * return before the arguments are evaluated, their number being reported in the next logged message
+ * of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param milliseconds: The length of the interval.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_EVERY_MS(sink_name, milliseconds, format, ...)                                                                                               \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::DEBUG, hob::log::LOG_TAG_DEBUG, every_interval, (milliseconds), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a debugging message as long as this call site has tokens left in its bucket, which is
+ * refilled at a constant rate. The dropped calls return before the arguments are evaluated, their
+ * number being reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param rate: The number of tokens added every second.
+ * @param burst: The capacity of the bucket (the number of calls that can be logged at once).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_TOKEN_BUCKET(sink_name, rate, burst, format, ...)                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::DEBUG, hob::log::LOG_TAG_DEBUG, token_bucket, (rate, burst), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for debugging purposes with structured key-value fields. The message is not
+ * formatted, the fields being encoded so that every sink renders them its own way (e.g. "key=value" by
+ * the terminal sink, members of a JSON object by the JSON sink).
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The keys and the values (booleans, numbers or strings) of the fields, alternating
+ * (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_KV(sink_name, message, ...)                                                                                                                  \
+	HOB_LOG_DETAILS_FIELDS(sink_name, hob::log::severity_level::DEBUG, hob::log::LOG_TAG_DEBUG, message, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for debugging purposes under a category, to the sinks the category is routed
+ * to. The check is a single load, the severity level of the category being resolved when it is
+ * configured.
+ * @param category: The handle of the category (see hob::log::get_category()).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_DEBUG_CATEGORY(category, format, ...)                                                                                                              \
+	HOB_LOG_DETAILS_CATEGORY(category, hob::log::severity_level::DEBUG, hob::log::LOG_TAG_DEBUG, format, ##__VA_ARGS__)
+
 #endif /*< HOB_LOG_STRIP_DEBUG */
 
 #ifndef HOB_LOG_STRIP_TRACE
@@ -122,6 +562,95 @@
  *****************************************************************************************************/
 #define HOB_LOG_TRACE(sink_name, format, ...) HOB_LOG_DETAILS_TRACE(sink_name, format, ##__VA_ARGS__)
 
+/** ***************************************************************************************************
+ * @brief Logs a message showing the path of the execution only once every n calls of this call site
+ * (the first call being logged). The dropped calls return before the arguments are evaluated, their
+ * number being reported in the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The sampling period.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_EVERY_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::TRACE, hob::log::LOG_TAG_TRACE, every_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message showing the path of the execution only for the first n calls of this call
+ * site. The dropped calls return before the arguments are evaluated.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param n: The number of calls to be logged.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_FIRST_N(sink_name, n, format, ...)                                                                                                           \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::TRACE, hob::log::LOG_TAG_TRACE, first_n, (n), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message showing the path of the execution at most once per interval for this call
+ * site. The dropped calls return before the arguments are evaluated, their number being reported in
+ * the next logged message of this call site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param milliseconds: The length of the interval.
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_EVERY_MS(sink_name, milliseconds, format, ...)                                                                                               \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::TRACE, hob::log::LOG_TAG_TRACE, every_interval, (milliseconds), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message showing the path of the execution as long as this call site has tokens left
+ * in its bucket, which is refilled at a constant rate. The dropped calls return before the
+ * arguments are evaluated, their number being reported in the next logged message of this call
+ * site.
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param rate: The number of tokens added every second.
+ * @param burst: The capacity of the bucket (the number of calls that can be logged at once).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_TOKEN_BUCKET(sink_name, rate, burst, format, ...)                                                                                            \
+	HOB_LOG_DETAILS_LIMITED(sink_name, hob::log::severity_level::TRACE, hob::log::LOG_TAG_TRACE, token_bucket, (rate, burst), format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message to show the path of the execution with structured key-value fields. The
+ * message is not formatted, the fields being encoded so that every sink renders them its own way (e.g.
+ * "key=value" by the terminal sink, members of a JSON object by the JSON sink).
+ * @param sink_name: The name of the sink that the log will be redirected to (does nothing if it is
+ * incorrect).
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The keys and the values (booleans, numbers or strings) of the fields, alternating
+ * (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_KV(sink_name, message, ...)                                                                                                                  \
+	HOB_LOG_DETAILS_FIELDS(sink_name, hob::log::severity_level::TRACE, hob::log::LOG_TAG_TRACE, message, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message to show the path of the execution under a category, to the sink the category
+ * is routed to. The check is a single load, the severity level of the category being resolved when it
+ * is configured.
+ * @param category: The handle of the category (see hob::log::get_category()).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: Arguments to be formatted (optional).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+#define HOB_LOG_TRACE_CATEGORY(category, format, ...)                                                                                                              \
+	HOB_LOG_DETAILS_CATEGORY(category, hob::log::severity_level::TRACE, hob::log::LOG_TAG_TRACE, format, ##__VA_ARGS__)
+
 #endif /*< HOB_LOG_STRIP_TRACE */
 
 /******************************************************************************************************
@@ -162,6 +691,163 @@ HOB_LOG_API void initialize(std::string_view configuration_file_path) noexcept(f
  *****************************************************************************************************/
 HOB_LOG_API extern void deinitialize(void) noexcept;
 
+/** ***************************************************************************************************
+ * @brief Renders again the values of {HOST} and {PID}. These are cached at initialization and are
+ * refreshed automatically in child processes after fork(), so this is needed only if the name of the
+ * host has been changed at runtime. It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+HOB_LOG_API extern void refresh_host_name(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Names the calling thread. The name is used by the {THREAD_NAME} placeholder and it is also
+ * given to the kernel (truncated to 15 characters) so it is visible in tools like perf or top. The
+ * logger does not need to be initialized. It is thread-safe.
+ * @param thread_name: The name of the calling thread (empty string to reset it).
+ * @returns void
+ * @throws std::bad_alloc: If making the copy of the name fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_thread_name(std::string_view thread_name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Enables or disables the call sites matching a filter, including the ones that have not been
+ * reached yet. When multiple rules match a call site the most recent one is applied, the call sites
+ * matching no rule being enabled. Disabled call sites drop their messages before formatting anything.
+ * The logger does not need to be initialized. It is thread-safe.
+ * @param filter: Selects the call sites.
+ * @param enabled: true to enable the call sites, false to disable them.
+ * @returns void
+ * @throws std::invalid_argument: If the line range is invalid.
+ * @throws std::bad_alloc: If storing the rule fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_callsites_enabled(const callsite_filter& filter, bool enabled) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Removes all the rules set by set_callsites_enabled(), enabling every call site. The logger
+ * does not need to be initialized. It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+HOB_LOG_API extern void reset_callsites(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Gets the handle of a category (e.g. "engine.net.lockstep"), creating it and its missing
+ * ancestors if needed. A category inherits the severity level and the sink of its parent unless they
+ * are overridden, the root category (empty name) accepting every severity and being routed to no
+ * sink by default. The handle is meant to be kept (e.g. in a static variable) and passed to the
+ * category macros (e.g. HOB_LOG_INFO_CATEGORY()). The logger does not need to be initialized. It is
+ * thread-safe.
+ * @param name: The path of the category (segments separated by dots).
+ * @returns The handle of the category, valid until the end of the program.
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category fails.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern category_handle get_category(std::string_view name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Overrides the severity level of a category. The descendants inheriting it are updated
+ * immediately. The logger does not need to be initialized. It is thread-safe.
+ * @param name: The path of the category (created if needed).
+ * @param severity_level: The severity level bitmask to be set.
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment or the severity level is not in
+ * the [0, 63] interval.
+ * @throws std::bad_alloc: If creating the category fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_category_level(std::string_view name, std::uint8_t severity_level) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Makes a category inherit the severity level of its parent again. The logger does not need to
+ * be initialized. It is thread-safe.
+ * @param name: The path of the category (created if needed).
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void reset_category_level(std::string_view name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Routes a category to a sink. The descendants inheriting it are updated immediately. The
+ * logger does not need to be initialized. It is thread-safe.
+ * @param name: The path of the category (created if needed).
+ * @param sink_name: The name of the sink (empty string to stop logging the category).
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category or storing the sink name fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_category_sink(std::string_view name, std::string_view sink_name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Makes a category inherit the sink of its parent again. The logger does not need to be
+ * initialized. It is thread-safe.
+ * @param name: The path of the category (created if needed).
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void reset_category_sink(std::string_view name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Adds a route: the messages of the given severities logged under a category or any of its
+ * descendants are sent to a sink as well, on top of the sink the category is routed to. E.g. routing
+ * the errors of the root category to a file and to the terminal, while the debug messages of "net"
+ * only go to a separate file. Every category keeps a routing table from severity to the set of sinks
+ * that accept it, so a message only visits the sinks it is written to. The logger does not need to
+ * be initialized (the route takes effect once the sink is added). It is thread-safe.
+ * @param name: The path of the category (created if needed).
+ * @param severity_level: The severities that are being routed.
+ * @param sink_name: The name of the sink.
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment or the severity level is not in
+ * the [0, 63] interval.
+ * @throws std::bad_alloc: If creating the category or storing the route fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void add_route(std::string_view name, std::uint8_t severity_level, std::string_view sink_name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Removes all the routes that have been added (the sinks the categories are routed to are
+ * kept). It is thread-safe.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+HOB_LOG_API extern void clear_routes(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Gets the call sites that have produced the most output, ordered by the bytes written and then
+ * by the messages sent. Only the call sites that have been reached at least once are known. The
+ * logger does not need to be initialized. It is thread-safe.
+ * @param count: The maximum number of call sites to be returned.
+ * @returns The statistics of the noisiest call sites.
+ * @throws std::bad_alloc: If the creation of the list fails.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern std::vector<callsite_statistics> get_noisiest_callsites(std::size_t count) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Sets the number of threads serving the sinks in async mode (1 by default). The sinks do not
+ * get a thread each: every thread runs one event loop over the sinks it has been given, logging a
+ * bounded number of messages from each of them in turn so a busy sink does not starve the others.
+ * The threads are started when the first sink enters the async mode and stopped after the last one
+ * leaves it. The logger does not need to be initialized. It is thread-safe.
+ * @param count: The number of threads.
+ * @returns void
+ * @throws std::invalid_argument: If the count is 0.
+ * @throws std::logic_error: If a sink is in async mode.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_backend_thread_count(std::size_t count) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Gets the number of threads serving the sinks in async mode. The logger does not need to be
+ * initialized. It is thread-safe.
+ * @param void
+ * @returns The number of threads.
+ * @throws N/A.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern std::size_t get_backend_thread_count(void) noexcept;
+
 /** ***************************************************************************************************
  * @brief Adds a terminal sink to the logger. It is **not** thread-safe.
  * @param sink_name: The name of the terminal sink (can **not** be empty string).
@@ -176,6 +862,22 @@ HOB_LOG_API extern void deinitialize(void) noexcept;
  *****************************************************************************************************/
 HOB_LOG_API extern void add_sink(std::string_view sink_name, const sink_terminal_configuration& configuration) noexcept(false);
 
+/** ***************************************************************************************************
+ * @brief Adds a JSON sink to the logger. Every message is written as a JSON object on its own line,
+ * holding the timestamp, the call site, the thread, the message and the fields of the structured
+ * messages (@see HOB_LOG_INFO_KV()). It is **not** thread-safe.
+ * @param sink_name: The name of the JSON sink (can **not** be empty string).
+ * @param configuration: The parameters that will be configured with.
+ * @returns void
+ * @throws std::logic_error: If the logger has not been initialized successfully or the sink name has
+ * already been added.
+ * @throws std::invalid_argument: If the stream is nullptr or severity level is not in the [0, 63]
+ * interval.
+ * @throws std::bad_alloc: If the memory allocation of the sink or making the copy of the name
+ * fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void add_sink(std::string_view sink_name, const sink_json_configuration& configuration) noexcept(false);
+
 /** ***************************************************************************************************
  * @brief Adds a composed sink to the logger. This sink type can not be configured after creation. It
  * is **not** thread-safe.
@@ -239,7 +941,10 @@ HOB_LOG_API [[nodiscard]] extern std::string_view get_default_sink_name(void) no
  * - {HOST}: The name of the host on which the program is running.
  * - {PID}: The identifier of the process that logged the message.
  * - {THREAD}: The identifier of the thread that logged the message.
+ * - {THREAD_NAME}: The name of the thread that logged the message (@see set_thread_name()), its
+ * identifier if it has not been named.
  * - {MESSAGE}: The message to be logged. This is mandatory!
+ * - {CONTEXT}: The fields of the thread context as "key=value" pairs (@see scoped_context).
  * @param format: The message format to be set.
  * @returns void
  * @throws std::logic_error: If the logger has not been initialized successfully.
@@ -277,6 +982,9 @@ HOB_LOG_API [[nodiscard]] extern std::string_view get_format(std::string_view si
  * - {MINUTE}: The minute (in numeric form, [0, 59]) when the message has been logged.
  * - {SECOND}: The second (in numeric form, [0, 59]) when the message has been logged.
  * - {MILLISECOND}: The millisecond (in numeric form, [0, 999]) when the message has been logged.
+ * - {MICROSECOND}: The microsecond (in numeric form, [0, 999999]) when the message has been logged.
+ * - {NANOSECOND}: The nanosecond (in numeric form, [0, 999999999]) when the message has been logged.
+ * - {EPOCH_NS}: The number of nanoseconds since the epoch when the message has been logged.
  * @param time_format: The time format to be set. It can be nullptr.
  * @returns void
  * @throws std::logic_error: If the logger has not been initialized successfully.
@@ -317,6 +1025,81 @@ HOB_LOG_API extern void set_severity_level(std::string_view sink_name, std::uint
  *****************************************************************************************************/
 HOB_LOG_API [[nodiscard]] extern std::uint8_t get_severity_level(std::string_view sink_name) noexcept(false);
 
+/** ***************************************************************************************************
+ * @brief Sets the clock the messages are being timestamped with. The logging thread only reads the
+ * raw value of the clock, the conversion to wall time being done when the message is formatted. It is
+ * **not** thread-safe.
+ * @param sink_name: The name of the sink the clock will be set to.
+ * @param source: The clock to be set.
+ * @returns void
+ * @throws std::logic_error: If the logger has not been initialized successfully.
+ * @throws std::invalid_argument: If the sink has not been successfully added or it is of unsupported
+ * type.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_timestamp_source(std::string_view sink_name, timestamp_source source) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Gets the clock the messages are being timestamped with. It is thread-safe.
+ * @param sink_name: The name of the sink the clock will be got from.
+ * @returns The current clock.
+ * @throws std::logic_error: If the logger has not been initialized successfully.
+ * @throws std::invalid_argument: If the sink has not been successfully added or it is of unsupported
+ * type.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern timestamp_source get_timestamp_source(std::string_view sink_name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Sets for how long consecutive identical messages (same call site and arguments) are being
+ * collapsed. The repetitions are neither formatted nor written, a single "last message repeated N
+ * times" line being logged when a different message arrives or when the timeout expires (even if
+ * no message arrives afterwards). It is **not** thread-safe.
+ * @param sink_name: The name of the sink the timeout will be set to.
+ * @param timeout: The timeout in milliseconds (0 disables the collapsing).
+ * @returns void
+ * @throws std::logic_error: If the logger has not been initialized successfully.
+ * @throws std::invalid_argument: If the sink has not been successfully added or it is of unsupported
+ * type.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_collapse_timeout(std::string_view sink_name, std::uint32_t timeout) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Gets for how long consecutive identical messages are being collapsed. It is thread-safe.
+ * @param sink_name: The name of the sink the timeout will be got from.
+ * @returns The timeout in milliseconds (0 if the collapsing is disabled).
+ * @throws std::logic_error: If the logger has not been initialized successfully.
+ * @throws std::invalid_argument: If the sink has not been successfully added or it is of unsupported
+ * type.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern std::uint32_t get_collapse_timeout(std::string_view sink_name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Sets the filters a sink runs before formatting a message, replacing the previous ones. A
+ * message is logged only if it passes the severity level and then every filter (e.g. only the
+ * category "net", excluding the messages containing "heartbeat"). The filters are compiled once into
+ * an array of predicates, the ones matching the content of the message being evaluated last since
+ * they need it formatted. It is **not** thread-safe.
+ * @param sink_name: The name of the sink the filters will be set to.
+ * @param filters: The filters (empty to remove them).
+ * @returns void
+ * @throws std::logic_error: If the logger has not been initialized successfully.
+ * @throws std::invalid_argument: If the sink has not been successfully added or it is of unsupported
+ * type or the field of a filter is not known.
+ * @throws std::bad_alloc: If making the copy of the filters fails.
+ *****************************************************************************************************/
+HOB_LOG_API extern void set_filters(std::string_view sink_name, const std::vector<sink_filter>& filters) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Gets the filters a sink runs before formatting a message. It is thread-safe.
+ * @param sink_name: The name of the sink the filters will be got from.
+ * @returns The filters, in the order they have been set (the patterns are valid until the filters
+ * are set again).
+ * @throws std::logic_error: If the logger has not been initialized successfully.
+ * @throws std::invalid_argument: If the sink has not been successfully added or it is of unsupported
+ * type.
+ * @throws std::bad_alloc: If the creation of the list fails.
+ *****************************************************************************************************/
+HOB_LOG_API [[nodiscard]] extern std::vector<sink_filter> get_filters(std::string_view sink_name) noexcept(false);
+
 /** ***************************************************************************************************
  * @brief Sets a new stream. It is **not** thread-safe.
  * @param sink_name: The name of the sink the stream will be set to.
@@ -28,6 +28,7 @@
 
 #include <string>
 #include <cstdio>
+#include <cstdint>
 
 #include "details/visibility.hpp"
 
@@ -57,15 +58,90 @@ struct HOB_LOG_API severity_level final
 	};
 };
 
+/** ***************************************************************************************************
+ * @brief Enumerates the clocks a sink can timestamp the messages with. The producer only stores the
+ * raw value of the clock, the conversion to wall time being done when the message is formatted.
+ *****************************************************************************************************/
+enum class timestamp_source : std::uint8_t
+{
+	SYSTEM,			 /**< std::chrono::system_clock (precise, the default).							 */
+	REALTIME_COARSE, /**< CLOCK_REALTIME_COARSE (cheaper, with the resolution of the scheduler tick). */
+	TSC				 /**< The time stamp counter, converted with a periodically recalibrated base.	 */
+};
+
+/** ***************************************************************************************************
+ * @brief Enumerates how the messages of a sink in async mode are being queued for the backend thread.
+ *****************************************************************************************************/
+enum class queue_layout : std::uint8_t
+{
+	SHARED,	   /**< One lock-free queue the logging threads share (the default).					  */
+	PER_THREAD /**< One wait-free queue per logging thread, merged by timestamp by the backend.		  */
+};
+
+/** ***************************************************************************************************
+ * @brief Selects the call sites (the places in the code where messages are being logged) that are
+ * being enabled or disabled at runtime.
+ *****************************************************************************************************/
+struct HOB_LOG_API callsite_filter final
+{
+	std::string_view file_pattern;	   /**< Glob matched against the file path or name (empty matches every file). */
+	std::string_view function_pattern; /**< Glob matched against the function name (empty matches every function). */
+	std::int32_t	 first_line;	   /**< The first line of the selected range.									   */
+	std::int32_t	 last_line;		   /**< The last line of the selected range (0 for up to the end of the file).	   */
+};
+
+/** ***************************************************************************************************
+ * @brief A predicate a sink evaluates before formatting a message. A message is logged only if it
+ * passes every filter of the sink.
+ *****************************************************************************************************/
+struct HOB_LOG_API sink_filter final
+{
+	/** ***********************************************************************************************
+	 * @brief Enumerates what the pattern of a filter is matched against.
+	 *************************************************************************************************/
+	enum class field : std::uint8_t
+	{
+		FILE,	  /**< The path of the file starts with the pattern.							 */
+		FUNCTION, /**< The name of the function starts with the pattern.					 */
+		CATEGORY, /**< The message is logged under the category or one of its descendants.	 */
+		THREAD,	  /**< The name of the thread starts with the pattern or its identifier is it. */
+		MESSAGE	  /**< The formatted message contains the pattern.					 */
+	};
+
+	field			 target;  /**< What the pattern is matched against.						*/
+	std::string_view pattern; /**< The text to be matched (empty matches every message).		*/
+	bool			 exclude; /**< The matching messages are rejected instead of the others.	*/
+};
+
+/** ***************************************************************************************************
+ * @brief Snapshot of the counters of a call site. The counters of the sinks are summed (e.g. a message
+ * written by two sinks counts its bytes twice).
+ *****************************************************************************************************/
+struct HOB_LOG_API callsite_statistics final
+{
+	std::string_view tag;			 /**< Tag indicating the type of message.								   */
+	std::string_view file_path;		 /**< The path of the file where the log function is being called.		   */
+	std::string_view function_name;	 /**< The name of the function where this call is made.					   */
+	std::int32_t	 line;			 /**< The line where the log function is being called.					   */
+	std::uint64_t	 messages_count; /**< Messages sent to the sinks.											   */
+	std::uint64_t	 bytes_count;	 /**< Bytes of the lines written by the sinks.							   */
+	std::uint64_t	 filtered_count; /**< Messages filtered by the severity level of a sink.					   */
+	std::uint64_t	 dropped_count;	 /**< Messages dropped by the rate limiter, collapsed or lost by a sink.   */
+};
+
 /** ***************************************************************************************************
  * @brief Defines the common configuration parameters for the sinks.
  *****************************************************************************************************/
 struct HOB_LOG_API sink_base_configuration final
 {
-	std::string_view format;		 /**< The format of the log message.								*/
-	std::string_view time_format;	 /**< The format of the time when the message has been logged.		*/
-	std::uint8_t	 severity_level; /**< Bitmask where bits set to 0 filter messages of that severity. */
-	bool			 async_mode;	 /**< The messages are being logged on a separate thread.			*/
+	std::string_view	format;				/**< The format of the log message.										*/
+	std::string_view	time_format;		/**< The format of the time when the message has been logged.			*/
+	std::uint8_t		severity_level;		/**< Bitmask where bits set to 0 filter messages of that severity.		*/
+	bool				async_mode;			/**< The messages are being formatted and logged on a backend thread.	*/
+	timestamp_source	clock;				/**< The clock the messages are being timestamped with.					*/
+	std::uint32_t		collapse_timeout;	/**< Milliseconds identical messages are collapsed for (0 disables it).	*/
+	std::uint32_t		queue_capacity;		/**< Messages the async queue holds (0 for the default of 4096).		*/
+	queue_layout		queue;				/**< How the messages are being queued in async mode.					*/
 };
 
 /** ***************************************************************************************************
@@ -78,6 +154,16 @@ struct HOB_LOG_API sink_terminal_configuration final
 	bool					color;	/**< The messages are colored based on severity level.									  */
 };
 
+/** ***************************************************************************************************
+ * @brief Defines the configuration parameters for a JSON sink. Every message is written as a JSON
+ * object on its own line, so the format of the base configuration is not used.
+ *****************************************************************************************************/
+struct HOB_LOG_API sink_json_configuration final
+{
+	sink_base_configuration base;	/**< Common configuration parameters.											*/
+	FILE*					stream; /**< Stream which the lines will be written to (owned by the caller).		*/
+};
+
 } /*< namespace hob::log */
 
 #endif /*< HOB_LOG_STRIP_ALL */
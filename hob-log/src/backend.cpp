@@ -0,0 +1,324 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file backend.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the functions defined in backend.hpp.
+ * @details Each backend thread runs one event loop over the workers it has been given: it logs up to
+ * a budget of messages from every worker in turn and only goes to sleep on its notifier once all of
+ * them are empty. The set of workers of a thread is protected by a mutex that the thread holds for a
+ * whole pass, so detaching a worker waits for the pass to end and the worker is never being served
+ * once it has been detached.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <stdexcept>
+
+#include "backend.hpp"
+#include "utility.hpp"
+
+namespace hob::log
+{
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many messages a backend thread logs from a worker before moving to the next one.
+ *****************************************************************************************************/
+static constexpr std::size_t SERVICE_BUDGET = 256UL;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief A thread serving a set of workers.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL backend_thread final
+{
+	notifier				wake_notifier;	/**< Wakes the thread up when any of its workers gets a message.	*/
+	std::mutex				mutex;			/**< Protects the workers and the served worker.					*/
+	std::condition_variable	served;			/**< Signaled when the thread is done serving a worker.				*/
+	std::vector<worker*>	workers;		/**< The workers being served.										*/
+	std::vector<worker*>	snapshot;		/**< The workers of the current pass (as much capacity as workers).	*/
+	worker*					serving;		/**< The worker being served outside the lock (nullptr if none).	*/
+	std::atomic<bool>		is_running;		/**< The flag indicating if the thread should keep running.			*/
+	std::thread				thread;			/**< The thread running the event loop.								*/
+};
+
+/** ***************************************************************************************************
+ * @brief The threads shared by every async sink.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL backend_pool final
+{
+	std::mutex										threads_mutex;	/**< Protects the threads and their count.									*/
+	std::vector<std::unique_ptr<backend_thread>>	threads;		/**< The running threads (empty while no worker is attached).				*/
+	std::size_t										threads_count;	/**< The number of threads being started when the first worker is attached.	*/
+	std::size_t										workers_count;	/**< The number of attached workers.										*/
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gets the pool of threads. It is never destroyed, so the workers owned by objects with static
+ * storage in other translation units (e.g. the logger) can still detach while the program exits.
+ * @param void
+ * @returns The pool of threads.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static backend_pool& get_pool(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief The event loop of a backend thread.
+ * @param thread: The thread running the loop.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void serve_workers(backend_thread& thread) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Starts the threads. It is **not** thread-safe (the threads mutex needs to be locked).
+ * @param pool: The pool the threads are being started for.
+ * @returns void
+ * @throws std::bad_alloc: If the allocation of the threads fails.
+ * @throws std::system_error: If starting a thread fails.
+ *****************************************************************************************************/
+static void start_threads(backend_pool& pool) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Stops and joins the threads. It is **not** thread-safe (the threads mutex needs to be locked).
+ * @param pool: The pool whose threads are being stopped.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void stop_threads(backend_pool& pool) noexcept;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+notifier& backend::attach(worker& worker) noexcept(false)
+{
+	backend_pool&				pool	   = get_pool();
+	std::lock_guard<std::mutex> lock	   = std::lock_guard{ pool.threads_mutex };
+	backend_thread*				thread	   = nullptr;
+	const bool					is_started = false == pool.threads.empty();
+
+	if (false == is_started)
+	{
+		start_threads(pool);
+	}
+
+	thread = std::ranges::min_element(pool.threads, {}, [](const std::unique_ptr<backend_thread>& item) -> std::size_t { return item->workers.size(); })->get();
+
+	try
+	{
+		std::lock_guard<std::mutex> thread_lock = std::lock_guard{ thread->mutex };
+
+		// Taking the snapshot of the workers in the event loop does not allocate.
+		thread->snapshot.reserve(thread->workers.size() + 1UL);
+		thread->workers.push_back(&worker);
+	}
+	catch (const std::bad_alloc&)
+	{
+		// A freshly started pool would keep running without any worker to serve.
+		if (false == is_started)
+		{
+			stop_threads(pool);
+		}
+		throw;
+	}
+
+	++pool.workers_count;
+	return thread->wake_notifier;
+}
+
+void backend::detach(worker& worker) noexcept
+{
+	backend_pool&				pool = get_pool();
+	std::lock_guard<std::mutex> lock = std::lock_guard{ pool.threads_mutex };
+
+	for (const std::unique_ptr<backend_thread>& thread : pool.threads)
+	{
+		std::unique_lock<std::mutex> thread_lock = std::unique_lock{ thread->mutex };
+
+		if (0UL != std::erase(thread->workers, &worker))
+		{
+			thread->served.wait(thread_lock, [&thread, &worker](void) -> bool { return &worker != thread->serving; });
+			break;
+		}
+	}
+
+	--pool.workers_count;
+	if (0UL == pool.workers_count)
+	{
+		stop_threads(pool);
+	}
+}
+
+void backend::set_thread_count(const std::size_t count) noexcept(false)
+{
+	backend_pool&				pool = get_pool();
+	std::lock_guard<std::mutex> lock = std::lock_guard{ pool.threads_mutex };
+
+	if (0UL == count)
+	{
+		throw std::invalid_argument{ "The backend needs at least 1 thread!" };
+	}
+
+	if (0UL != pool.workers_count)
+	{
+		throw std::logic_error{ "The number of backend threads can not be changed while a sink is in async mode!" };
+	}
+
+	pool.threads_count = count;
+}
+
+std::size_t backend::get_thread_count(void) noexcept
+{
+	backend_pool&				pool = get_pool();
+	std::lock_guard<std::mutex> lock = std::lock_guard{ pool.threads_mutex };
+
+	return pool.threads_count;
+}
+
+static backend_pool& get_pool(void) noexcept
+{
+	static backend_pool* const pool = new backend_pool{ {}, {}, 1UL, 0UL };
+	return *pool;
+}
+
+static void serve_workers(backend_thread& thread) noexcept
+{
+	std::size_t	  logged_count = 0UL;
+	std::uint32_t wake_value   = 0U;
+	bool		  is_idle	   = false;
+
+	while (true == thread.is_running.load(std::memory_order_acquire))
+	{
+		{
+			std::lock_guard<std::mutex> lock = std::lock_guard{ thread.mutex };
+			thread.snapshot.assign(thread.workers.begin(), thread.workers.end());
+		}
+
+		// The messages are logged outside the lock, so the sinks' I/O does not block attaching and detaching.
+		logged_count = 0UL;
+		for (worker* const worker : thread.snapshot)
+		{
+			{
+				std::lock_guard<std::mutex> lock = std::lock_guard{ thread.mutex };
+
+				if (thread.workers.end() == std::ranges::find(thread.workers, worker))
+				{
+					continue;
+				}
+
+				thread.serving = worker;
+			}
+
+			logged_count += worker->log_messages(SERVICE_BUDGET);
+
+			{
+				std::lock_guard<std::mutex> lock = std::lock_guard{ thread.mutex };
+				thread.serving					 = nullptr;
+			}
+			thread.served.notify_all();
+		}
+
+		if (0UL != logged_count)
+		{
+			continue;
+		}
+
+		wake_value = thread.wake_notifier.prepare_wait();
+		{
+			std::lock_guard<std::mutex> lock = std::lock_guard{ thread.mutex };
+			is_idle = std::ranges::all_of(thread.workers, [](const worker* const worker) -> bool { return worker->is_empty(); });
+		}
+
+		if (true == is_idle && true == thread.is_running.load(std::memory_order_acquire))
+		{
+			thread.wake_notifier.wait(wake_value);
+			continue;
+		}
+
+		thread.wake_notifier.cancel_wait();
+	}
+}
+
+static void start_threads(backend_pool& pool) noexcept(false)
+{
+	pool.threads.reserve(pool.threads_count);
+
+	try
+	{
+		for (std::size_t index = 0UL; index < pool.threads_count; ++index)
+		{
+			backend_thread& thread = *pool.threads.emplace_back(std::make_unique<backend_thread>());
+
+			thread.is_running.store(true, std::memory_order_relaxed);
+			thread.thread = std::thread{ serve_workers, std::ref(thread) };
+		}
+	}
+	catch (...)
+	{
+		stop_threads(pool);
+		throw;
+	}
+}
+
+static void stop_threads(backend_pool& pool) noexcept
+{
+	for (const std::unique_ptr<backend_thread>& thread : pool.threads)
+	{
+		thread->is_running.store(false, std::memory_order_release);
+		thread->wake_notifier.interrupt();
+	}
+
+	for (const std::unique_ptr<backend_thread>& thread : pool.threads)
+	{
+		if (true == thread->thread.joinable())
+		{
+			thread->thread.join();
+		}
+	}
+
+	pool.threads.clear();
+}
+
+} /*< namespace hob::log */
@@ -0,0 +1,235 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file callsite_registry.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the functions defined in callsite_registry.hpp and the registration of
+ * the call sites.
+ * @details The call sites are registered the first time they are reached (a function-local static
+ * variable can not be reached before), so the rules are kept and applied both to the call sites that
+ * are already in the table and to the ones registered later. The logging path only reads the status
+ * of the call site, the table being locked just when a call site is reached for the first time or
+ * when the rules change.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <fnmatch.h>
+
+#include "callsite_registry.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief Owning copy of a filter together with the status it gives to the call sites it matches.
+ *****************************************************************************************************/
+struct callsite_rule final
+{
+	std::string	 file_pattern;	   /**< Glob matched against the file path or name (empty matches every file).		 */
+	std::string	 function_pattern; /**< Glob matched against the function name (empty matches every function).	 */
+	std::int32_t first_line;	   /**< The first line of the selected range.										 */
+	std::int32_t last_line;		   /**< The last line of the selected range (0 for up to the end of the file).		 */
+	std::uint8_t status;		   /**< The status given to the matched call sites (see details::callsite::status). */
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Protects the call sites and the rules.
+ *****************************************************************************************************/
+static std::mutex callsites_mutex = {};
+
+/** ***************************************************************************************************
+ * @brief The call sites that have been reached at least once.
+ *****************************************************************************************************/
+static std::vector<const details::callsite*> callsites = {};
+
+/** ***************************************************************************************************
+ * @brief The rules in the order they have been added (the most recent matching one is applied).
+ *****************************************************************************************************/
+static std::vector<callsite_rule> rules = {};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Checks if a rule selects a call site. It is **not** thread-safe.
+ * @param rule: The rule to be checked.
+ * @param callsite: The call site to be checked (its file path and function name are string literals
+ * so they are null-terminated).
+ * @returns true - the rule selects the call site.
+ * @returns false - the rule does not select the call site.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static bool matches(const callsite_rule& rule, const details::callsite& callsite) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Decides the status of a call site based on the rules. It is **not** thread-safe.
+ * @param callsite: The call site whose status is being decided.
+ * @returns The status of the most recent rule matching the call site or enabled if none matches.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static std::uint8_t get_status(const details::callsite& callsite) noexcept;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+std::uint8_t details::register_callsite(const callsite& callsite) noexcept
+{
+	std::lock_guard<std::mutex> lock   = std::lock_guard{ callsites_mutex };
+	std::uint8_t				status = callsite.state.load(std::memory_order_relaxed);
+
+	if (callsite::UNREGISTERED != status)
+	{
+		return status;
+	}
+
+	status = get_status(callsite);
+
+	try
+	{
+		callsites.push_back(&callsite);
+		callsite.state.store(status, std::memory_order_relaxed);
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while registering call site! (error message: \"{}\")", exception.what());
+	}
+
+	return status;
+}
+
+void callsite_registry::add_rule(const callsite_filter& filter, const bool enabled) noexcept(false)
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ callsites_mutex };
+
+	if (0 > filter.first_line || 0 > filter.last_line || (0 != filter.last_line && filter.first_line > filter.last_line))
+	{
+		throw std::invalid_argument{ "The line range of the call sites is invalid!" };
+	}
+
+	const callsite_rule& rule = rules.emplace_back(std::string{ filter.file_pattern },
+												   std::string{ filter.function_pattern },
+												   filter.first_line,
+												   filter.last_line,
+												   true == enabled ? details::callsite::ENABLED : details::callsite::DISABLED);
+
+	for (const details::callsite* const callsite : callsites)
+	{
+		if (true == matches(rule, *callsite))
+		{
+			callsite->state.store(rule.status, std::memory_order_relaxed);
+		}
+	}
+}
+
+void callsite_registry::clear_rules(void) noexcept
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ callsites_mutex };
+
+	rules.clear();
+	for (const details::callsite* const callsite : callsites)
+	{
+		callsite->state.store(details::callsite::ENABLED, std::memory_order_relaxed);
+	}
+}
+
+std::vector<callsite_statistics> callsite_registry::get_statistics(const std::size_t count) noexcept(false)
+{
+	std::vector<callsite_statistics> statistics = {};
+	std::unique_lock<std::mutex>	 lock		= std::unique_lock{ callsites_mutex };
+
+	statistics.reserve(callsites.size());
+	for (const details::callsite* const callsite : callsites)
+	{
+		(void)statistics.emplace_back(callsite->tag,
+									  callsite->file_path,
+									  callsite->function_name,
+									  callsite->line,
+									  callsite->messages_count.load(std::memory_order_relaxed),
+									  callsite->bytes_count.load(std::memory_order_relaxed),
+									  callsite->filtered_count.load(std::memory_order_relaxed),
+									  callsite->dropped_count.load(std::memory_order_relaxed));
+	}
+	lock.unlock();
+
+	std::partial_sort(statistics.begin(),
+					  statistics.begin() + static_cast<std::ptrdiff_t>(std::min(count, statistics.size())),
+					  statistics.end(),
+					  [](const callsite_statistics& left, const callsite_statistics& right) -> bool
+					  {
+						  return left.bytes_count != right.bytes_count ? left.bytes_count > right.bytes_count
+																	   : left.messages_count > right.messages_count;
+					  });
+
+	statistics.resize(std::min(count, statistics.size()));
+	return statistics;
+}
+
+static bool matches(const callsite_rule& rule, const details::callsite& callsite) noexcept
+{
+	if (false == rule.file_pattern.empty() && 0 != fnmatch(rule.file_pattern.c_str(), callsite.file_path.data(), 0)
+		&& 0 != fnmatch(rule.file_pattern.c_str(), callsite.file_name.data(), 0))
+	{
+		return false;
+	}
+
+	if (false == rule.function_pattern.empty() && 0 != fnmatch(rule.function_pattern.c_str(), callsite.function_name.data(), 0))
+	{
+		return false;
+	}
+
+	return rule.first_line <= callsite.line && (0 == rule.last_line || rule.last_line >= callsite.line);
+}
+
+static std::uint8_t get_status(const details::callsite& callsite) noexcept
+{
+	for (auto rule = rules.rbegin(); rules.rend() != rule; ++rule)
+	{
+		if (true == matches(*rule, callsite))
+		{
+			return rule->status;
+		}
+	}
+
+	return details::callsite::ENABLED;
+}
+
+} /*< namespace hob::log */
@@ -0,0 +1,406 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file category_registry.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the functions defined in category_registry.hpp.
+ * @details The categories are kept in a map ordered by their path, so the descendants of a category
+ * are stored right after it and every category comes after its parent. A change is propagated by
+ * resolving the changed category and walking its descendants in order, each one inheriting from its
+ * already resolved parent. Resolving a category also rebuilds its routing table: for every severity
+ * the sink it is routed to and the sinks of the routes added to it or to its ancestors, restricted
+ * to the sinks that accept the severity. Adding a route or changing the sinks rebuilds every table.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <array>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <mutex>
+#include <algorithm>
+#include <stdexcept>
+
+#include "category_registry.hpp"
+#include "types.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The severity level of the root category if it has not been overridden (every severity).
+ *****************************************************************************************************/
+static constexpr std::uint8_t DEFAULT_SEVERITY_LEVEL = 0x3FU;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief A category together with its own configuration.
+ *****************************************************************************************************/
+struct category_node final
+{
+	details::category			category;		/**< The resolved configuration read by the logging path.	*/
+	std::optional<std::uint8_t> level;			/**< The own severity level (inherited if it has none).		*/
+	const std::string*			sink_name;		/**< The own sink (nullptr if it is inherited).				*/
+	std::uint8_t				resolved_level; /**< The own or inherited severity level.					*/
+	const std::string*			resolved_sink;	/**< The own or inherited sink (can not be nullptr).		*/
+
+	/** ***********************************************************************************************
+	 * @brief The sinks of the own and inherited routes, by severity (not restricted to the sinks that
+	 * accept the severity).
+	 *************************************************************************************************/
+	std::array<std::uint64_t, details::SEVERITY_COUNT> routed_sinks;
+};
+
+/** ***************************************************************************************************
+ * @brief The messages of some severities logged under a category are sent to a sink as well.
+ *****************************************************************************************************/
+struct route final
+{
+	std::string	 category;		 /**< The path of the category (its descendants being routed too).	*/
+	std::uint8_t severity_level; /**< The severities that are being routed.							*/
+	std::string	 sink_name;		 /**< The name of the sink the messages are sent to.				*/
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Protects the categories, the sink names, the routes and the sinks.
+ *****************************************************************************************************/
+static std::mutex categories_mutex = {};
+
+/** ***************************************************************************************************
+ * @brief The categories that have been created, by their path.
+ *****************************************************************************************************/
+static std::map<std::string, category_node, std::less<>> categories = {};
+
+/** ***************************************************************************************************
+ * @brief The names of the sinks the categories have been routed to (never erased).
+ *****************************************************************************************************/
+static std::set<std::string, std::less<>> sink_names = {};
+
+/** ***************************************************************************************************
+ * @brief The routes that have been added, in the order they have been added.
+ *****************************************************************************************************/
+static std::vector<route> routes = {};
+
+/** ***************************************************************************************************
+ * @brief The sinks of the logger, in the order of their indices.
+ *****************************************************************************************************/
+static std::vector<category_registry::sink_entry> sinks = {};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Checks that a category path has no empty segment. It is thread-safe.
+ * @param name: The path of the category.
+ * @returns void
+ * @throws std::invalid_argument: If the name has an empty segment.
+ *****************************************************************************************************/
+static void throw_if_name_invalid(std::string_view name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Gets the path of the parent of a category. It is thread-safe.
+ * @param name: The path of the category (can not be the root).
+ * @returns The path of the parent.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static std::string_view get_parent_name(std::string_view name) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Gets a category, creating it (and its missing ancestors) if needed. It is **not**
+ * thread-safe.
+ * @param name: The path of the category.
+ * @returns Reference to the category.
+ * @throws std::invalid_argument: If the name has an empty segment.
+ * @throws std::bad_alloc: If creating the category fails.
+ *****************************************************************************************************/
+[[nodiscard]] static category_node& get_node(std::string_view name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Gets the interned copy of a sink name. It is **not** thread-safe.
+ * @param sink_name: The name of the sink.
+ * @returns The copy, valid until the end of the program.
+ * @throws std::bad_alloc: If storing the sink name fails.
+ *****************************************************************************************************/
+[[nodiscard]] static const std::string* intern(std::string_view sink_name) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Gets the bit of a sink in the bitsets of the routing table. It is **not** thread-safe.
+ * @param sink_name: The name of the sink.
+ * @returns The bit of the sink or 0 if the sink is unknown or does not fit in the table.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static std::uint64_t get_sink_bit(std::string_view sink_name) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Gets the sinks that accept a severity. It is **not** thread-safe.
+ * @param severity_bit: The bit of the severity.
+ * @returns The bitset of the sinks.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static std::uint64_t get_accepting_sinks(std::uint8_t severity_bit) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Resolves a category from its own configuration and the one of its parent. It is **not**
+ * thread-safe.
+ * @param name: The path of the category.
+ * @param node: The category to be resolved.
+ * @param parent: The resolved parent (nullptr for the root).
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void resolve(std::string_view name, category_node& node, const category_node* parent) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Resolves a category and all of its descendants. It is **not** thread-safe.
+ * @param name: The path of the category that has been changed.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void propagate(std::string_view name) noexcept;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+category_handle category_registry::get(const std::string_view name) noexcept(false)
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+	return &get_node(name).category;
+}
+
+void category_registry::set_level(const std::string_view name, const std::uint8_t severity_level) noexcept(false)
+{
+	if (63U < severity_level)
+	{
+		throw std::invalid_argument{ "Severity level is not in the [0, 63] interval!" };
+	}
+
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+
+	get_node(name).level = severity_level;
+	propagate(name);
+}
+
+void category_registry::reset_level(const std::string_view name) noexcept(false)
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+
+	get_node(name).level = true == name.empty() ? std::optional<std::uint8_t>{ DEFAULT_SEVERITY_LEVEL } : std::nullopt;
+	propagate(name);
+}
+
+void category_registry::set_sink(const std::string_view name, const std::string_view sink_name) noexcept(false)
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+	category_node&				node = get_node(name);
+
+	node.sink_name = intern(sink_name);
+	propagate(name);
+}
+
+void category_registry::reset_sink(const std::string_view name) noexcept(false)
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+	category_node&				node = get_node(name);
+
+	node.sink_name = true == name.empty() ? intern("") : nullptr;
+	propagate(name);
+}
+
+void category_registry::add_route(const std::string_view name, const std::uint8_t severity_level, const std::string_view sink_name) noexcept(false)
+{
+	if (63U < severity_level)
+	{
+		throw std::invalid_argument{ "Severity level is not in the [0, 63] interval!" };
+	}
+
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+
+	(void)get_node(name);
+	(void)routes.emplace_back(std::string{ name }, severity_level, std::string{ sink_name });
+	propagate(name);
+}
+
+void category_registry::clear_routes(void) noexcept
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+
+	routes.clear();
+	propagate("");
+}
+
+void category_registry::set_sinks(std::vector<sink_entry> sinks) noexcept(false)
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ categories_mutex };
+
+	hob::log::sinks = std::move(sinks);
+	propagate("");
+}
+
+static void throw_if_name_invalid(const std::string_view name) noexcept(false)
+{
+	if (true == name.starts_with('.') || true == name.ends_with('.') || std::string_view::npos != name.find(".."))
+	{
+		throw std::invalid_argument{ "Category name has an empty segment!" };
+	}
+}
+
+static std::string_view get_parent_name(const std::string_view name) noexcept
+{
+	const std::size_t separator = name.rfind('.');
+	return std::string_view::npos == separator ? std::string_view{} : name.substr(0UL, separator);
+}
+
+static category_node& get_node(const std::string_view name) noexcept(false)
+{
+	auto			   iterator = categories.find(name);
+	category_node*	   parent	= nullptr;
+	category_node*	   node		= nullptr;
+	const std::string* sink		= nullptr;
+
+	if (categories.end() != iterator)
+	{
+		return iterator->second;
+	}
+
+	throw_if_name_invalid(name);
+
+	// The ancestors and the interned name are created first, so a failure leaves no half made node.
+	parent	 = true == name.empty() ? nullptr : &get_node(get_parent_name(name));
+	sink	 = intern("");
+	iterator = categories.try_emplace(std::string{ name }).first;
+	node	 = &iterator->second;
+
+	node->category.name = iterator->first;
+	node->level			= nullptr == parent ? std::optional<std::uint8_t>{ DEFAULT_SEVERITY_LEVEL } : std::nullopt;
+	node->sink_name		= nullptr == parent ? sink : nullptr;
+	resolve(name, *node, parent);
+
+	return *node;
+}
+
+static const std::string* intern(const std::string_view sink_name) noexcept(false)
+{
+	return &*sink_names.emplace(sink_name).first;
+}
+
+static std::uint64_t get_sink_bit(const std::string_view sink_name) noexcept
+{
+	const std::size_t count = std::min(sinks.size(), details::MAXIMUM_ROUTED_SINKS);
+
+	for (std::size_t index = 0UL; index < count; ++index)
+	{
+		if (sink_name == sinks[index].name)
+		{
+			return 1UL << index;
+		}
+	}
+
+	return 0UL;
+}
+
+static std::uint64_t get_accepting_sinks(const std::uint8_t severity_bit) noexcept
+{
+	const std::size_t count		= std::min(sinks.size(), details::MAXIMUM_ROUTED_SINKS);
+	std::uint64_t	  accepting = 0UL;
+
+	for (std::size_t index = 0UL; index < count; ++index)
+	{
+		accepting |= 0U != (severity_bit & sinks[index].severity_level) ? 1UL << index : 0UL;
+	}
+
+	return accepting;
+}
+
+static void resolve(const std::string_view name, category_node& node, const category_node* const parent) noexcept
+{
+	std::uint64_t sink_bit		  = 0UL;
+	std::uint64_t destinations	  = 0UL;
+	std::uint8_t  severity_bit	  = 0U;
+	std::uint8_t  effective_level = 0U;
+
+	node.resolved_level = true == node.level.has_value() ? *node.level : parent->resolved_level;
+	node.resolved_sink	= nullptr != node.sink_name ? node.sink_name : parent->resolved_sink;
+	node.routed_sinks	= nullptr == parent ? std::array<std::uint64_t, details::SEVERITY_COUNT>{} : parent->routed_sinks;
+
+	for (const route& route : routes)
+	{
+		if (name != route.category)
+		{
+			continue;
+		}
+
+		sink_bit = get_sink_bit(route.sink_name);
+		for (std::size_t index = 0UL; index < details::SEVERITY_COUNT; ++index)
+		{
+			node.routed_sinks[index] |= 0U != (route.severity_level & (1U << index)) ? sink_bit : 0UL;
+		}
+	}
+
+	sink_bit = get_sink_bit(*node.resolved_sink);
+	for (std::size_t index = 0UL; index < details::SEVERITY_COUNT; ++index)
+	{
+		severity_bit = static_cast<std::uint8_t>(1U << index);
+		destinations = 0U != (severity_bit & node.resolved_level) ? (sink_bit | node.routed_sinks[index]) & get_accepting_sinks(severity_bit) : 0UL;
+
+		node.category.routes[index].store(destinations, std::memory_order_release);
+		effective_level |= 0UL != destinations ? severity_bit : 0U;
+	}
+
+	node.category.effective_level.store(effective_level, std::memory_order_release);
+}
+
+static void propagate(const std::string_view name) noexcept
+{
+	for (auto iterator = categories.lower_bound(name); categories.end() != iterator && true == iterator->first.starts_with(name); ++iterator)
+	{
+		const std::string_view path = iterator->first;
+
+		// Siblings sharing the prefix (e.g. "net2" for "net") are not descendants.
+		if (path.length() != name.length() && false == name.empty() && '.' != path[name.length()])
+		{
+			continue;
+		}
+
+		resolve(path, iterator->second, true == path.empty() ? nullptr : &categories.find(get_parent_name(path))->second);
+	}
+}
+
+} /*< namespace hob::log */
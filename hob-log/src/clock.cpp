@@ -0,0 +1,285 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file clock.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the functions defined in clock.hpp.
+ * @details The calibration of the time stamp counter (a measured pair of ticks and wall time plus the
+ * length of a tick) is published through a sequence lock: the conversions only read it and retry if
+ * a recalibration has been published meanwhile, the recalibration being done by whichever converting
+ * thread notices that the base is older than a second.
+ * @todo N/A.
+ * @bug On architectures other than x86 the time stamp counter is emulated with CLOCK_MONOTONIC_RAW.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <cmath>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif /*< defined(__x86_64__) || defined(__i386__) */
+
+#include "clock.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief How long the first measurement of the time stamp counter frequency takes (in nanoseconds).
+ *****************************************************************************************************/
+static constexpr std::int64_t CALIBRATION_INTERVAL = 1'000'000L;
+
+/** ***************************************************************************************************
+ * @brief How old the base of the conversion can get before it is being recalibrated (in nanoseconds).
+ *****************************************************************************************************/
+static constexpr double RECALIBRATION_PERIOD = 1'000'000'000.0;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief A consistent copy of the calibration of the time stamp counter.
+ *****************************************************************************************************/
+struct calibration final
+{
+	std::uint64_t ticks;				/**< The value of the counter when the base has been measured. */
+	std::int64_t  nanoseconds;			/**< The wall time when the base has been measured.			   */
+	double		  nanoseconds_per_tick; /**< The measured length of a tick.							   */
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The sequence of the calibration, odd while a recalibration is being published.
+ *****************************************************************************************************/
+static std::atomic<std::uint64_t> sequence = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The value of the counter when the base has been measured.
+ *****************************************************************************************************/
+static std::atomic<std::uint64_t> base_ticks = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The wall time when the base has been measured.
+ *****************************************************************************************************/
+static std::atomic<std::int64_t> base_nanoseconds = 0L;
+
+/** ***************************************************************************************************
+ * @brief The measured length of a tick.
+ *****************************************************************************************************/
+static std::atomic<double> nanoseconds_per_tick = 0.0;
+
+/** ***************************************************************************************************
+ * @brief Guarantees that the first measurement is done only once.
+ *****************************************************************************************************/
+static std::once_flag calibration_flag = {};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Reads a POSIX clock. It is thread-safe.
+ * @param clock_id: The identifier of the clock.
+ * @returns The value of the clock in nanoseconds.
+ * @throws N/A.
+ *****************************************************************************************************/
+static std::int64_t read_posix_clock(clockid_t clock_id) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Reads the time stamp counter. It is thread-safe.
+ * @param void
+ * @returns The value of the counter.
+ * @throws N/A.
+ *****************************************************************************************************/
+static std::uint64_t read_counter(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Gets a consistent copy of the calibration. It is thread-safe.
+ * @param void
+ * @returns The current calibration.
+ * @throws N/A.
+ *****************************************************************************************************/
+static calibration load_calibration(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Measures a new base and refines the length of a tick over the interval since the previous
+ * base. If another thread is already doing it the call does nothing. It is thread-safe.
+ * @param previous: The calibration that has been found to be too old.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void recalibrate(const calibration& previous) noexcept;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+std::uint64_t clock::read(const timestamp_source source) noexcept
+{
+	switch (source)
+	{
+		case timestamp_source::REALTIME_COARSE:
+		{
+#ifdef CLOCK_REALTIME_COARSE
+			return static_cast<std::uint64_t>(read_posix_clock(CLOCK_REALTIME_COARSE));
+#else
+			return static_cast<std::uint64_t>(read_posix_clock(CLOCK_REALTIME));
+#endif /*< CLOCK_REALTIME_COARSE */
+		}
+		case timestamp_source::TSC:
+		{
+			return read_counter();
+		}
+		case timestamp_source::SYSTEM:
+		default:
+		{
+			return static_cast<std::uint64_t>(utility::get_timestamp());
+		}
+	}
+}
+
+std::int64_t clock::to_nanoseconds(const timestamp_source source, const std::uint64_t ticks) noexcept
+{
+	calibration calibration = {};
+
+	if (timestamp_source::TSC != source)
+	{
+		return static_cast<std::int64_t>(ticks);
+	}
+
+	calibrate();
+
+	calibration = load_calibration();
+	if (ticks > calibration.ticks && RECALIBRATION_PERIOD < static_cast<double>(ticks - calibration.ticks) * calibration.nanoseconds_per_tick)
+	{
+		recalibrate(calibration);
+		calibration = load_calibration();
+	}
+
+	return calibration.nanoseconds
+		 + std::llround(static_cast<double>(static_cast<std::int64_t>(ticks - calibration.ticks)) * calibration.nanoseconds_per_tick);
+}
+
+void clock::calibrate(void) noexcept
+{
+	std::call_once(calibration_flag,
+				   [](void) -> void
+				   {
+					   const std::uint64_t start_ticks		 = read_counter();
+					   const std::int64_t  start_nanoseconds = read_posix_clock(CLOCK_REALTIME);
+					   std::uint64_t	   ticks			 = 0UL;
+					   std::int64_t		   nanoseconds		 = 0L;
+
+					   do
+					   {
+						   ticks	   = read_counter();
+						   nanoseconds = read_posix_clock(CLOCK_REALTIME);
+					   }
+					   while (CALIBRATION_INTERVAL > nanoseconds - start_nanoseconds || start_ticks >= ticks);
+
+					   base_ticks.store(ticks, std::memory_order_relaxed);
+					   base_nanoseconds.store(nanoseconds, std::memory_order_relaxed);
+					   nanoseconds_per_tick.store(static_cast<double>(nanoseconds - start_nanoseconds) / static_cast<double>(ticks - start_ticks),
+												  std::memory_order_relaxed);
+					   sequence.store(2UL, std::memory_order_release);
+				   });
+}
+
+static std::int64_t read_posix_clock(const clockid_t clock_id) noexcept
+{
+	timespec time = {};
+
+	(void)clock_gettime(clock_id, &time);
+	return static_cast<std::int64_t>(time.tv_sec) * 1'000'000'000L + static_cast<std::int64_t>(time.tv_nsec);
+}
+
+static std::uint64_t read_counter(void) noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return static_cast<std::uint64_t>(read_posix_clock(CLOCK_MONOTONIC_RAW));
+#endif /*< defined(__x86_64__) || defined(__i386__) */
+}
+
+static calibration load_calibration(void) noexcept
+{
+	calibration	  calibration = {};
+	std::uint64_t start		  = 0UL;
+
+	do
+	{
+		start = sequence.load(std::memory_order_acquire);
+
+		calibration.ticks				 = base_ticks.load(std::memory_order_relaxed);
+		calibration.nanoseconds			 = base_nanoseconds.load(std::memory_order_relaxed);
+		calibration.nanoseconds_per_tick = nanoseconds_per_tick.load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+	while (0UL != (start & 1UL) || start != sequence.load(std::memory_order_relaxed));
+
+	return calibration;
+}
+
+static void recalibrate(const calibration& previous) noexcept
+{
+	std::uint64_t start		  = sequence.load(std::memory_order_relaxed);
+	std::uint64_t ticks		  = 0UL;
+	std::int64_t  nanoseconds = 0L;
+
+	if (0UL != (start & 1UL) || false == sequence.compare_exchange_strong(start, start + 1UL, std::memory_order_acquire))
+	{
+		return;
+	}
+
+	std::atomic_thread_fence(std::memory_order_release);
+
+	ticks		= read_counter();
+	nanoseconds = read_posix_clock(CLOCK_REALTIME);
+
+	if (ticks > previous.ticks && nanoseconds > previous.nanoseconds)
+	{
+		base_ticks.store(ticks, std::memory_order_relaxed);
+		base_nanoseconds.store(nanoseconds, std::memory_order_relaxed);
+		nanoseconds_per_tick.store(static_cast<double>(nanoseconds - previous.nanoseconds) / static_cast<double>(ticks - previous.ticks),
+								   std::memory_order_relaxed);
+	}
+
+	sequence.store(start + 2UL, std::memory_order_release);
+}
+
+} /*< namespace hob::log */
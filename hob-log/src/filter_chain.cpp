@@ -0,0 +1,246 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file filter_chain.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the class defined in filter_chain.hpp.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <algorithm>
+#include <stdexcept>
+#include <cassert>
+
+#include "filter_chain.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief Matches the path of the file the message has been logged from. It is thread-safe.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @param pattern: The prefix of the path.
+ * @returns true - the path starts with the pattern.
+ * @returns false - the path does not start with the pattern.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static bool match_file(const record& record, std::string_view pattern) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Matches the name of the function the message has been logged from. It is thread-safe.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @param pattern: The prefix of the name.
+ * @returns true - the name starts with the pattern.
+ * @returns false - the name does not start with the pattern.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static bool match_function(const record& record, std::string_view pattern) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Matches the category the message has been logged under. It is thread-safe.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @param pattern: The path of the category.
+ * @returns true - the message has been logged under the category or one of its descendants.
+ * @returns false - the message has been logged under another category or by the name of the sink.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static bool match_category(const record& record, std::string_view pattern) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Matches the thread the message has been logged from. It is thread-safe.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @param pattern: The prefix of the name or the identifier of the thread.
+ * @returns true - the name of the thread starts with the pattern or its identifier is the pattern.
+ * @returns false - the message has been logged from another thread.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static bool match_thread(const record& record, std::string_view pattern) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Matches the content of the message, formatting it if it has not been already. It is
+ * thread-safe.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @param pattern: The text searched in the message.
+ * @returns true - the message contains the pattern or it could not be formatted.
+ * @returns false - the message does not contain the pattern.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static bool match_message(const record& record, std::string_view pattern) noexcept;
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+filter_chain::filter_chain(void) noexcept
+	: patterns{}
+	, predicates{}
+{
+}
+
+void filter_chain::compile(const std::vector<sink_filter>& filters) noexcept(false)
+{
+	std::string			   patterns	  = {};
+	std::vector<predicate> predicates = {};
+	matcher				   match	  = nullptr;
+
+	assert(nullptr != this);
+
+	predicates.reserve(filters.size());
+	for (std::size_t index = 0UL; index < filters.size(); ++index)
+	{
+		switch (filters[index].target)
+		{
+			case sink_filter::field::FILE:
+			{
+				match = &match_file;
+				break;
+			}
+			case sink_filter::field::FUNCTION:
+			{
+				match = &match_function;
+				break;
+			}
+			case sink_filter::field::CATEGORY:
+			{
+				match = &match_category;
+				break;
+			}
+			case sink_filter::field::THREAD:
+			{
+				match = &match_thread;
+				break;
+			}
+			case sink_filter::field::MESSAGE:
+			{
+				match = &match_message;
+				break;
+			}
+			default:
+			{
+				throw std::invalid_argument{ "Unknown field of a sink filter!" };
+			}
+		}
+
+		(void)predicates.emplace_back(match, patterns.length(), filters[index].pattern.length(), filters[index].exclude, filters[index].target, index);
+		(void)patterns.append(filters[index].pattern);
+	}
+
+	// Matching the content needs the message to be formatted, so it is checked last.
+	(void)std::stable_partition(
+		predicates.begin(), predicates.end(), [](const predicate& predicate) -> bool { return sink_filter::field::MESSAGE != predicate.target; });
+
+	this->patterns	 = std::move(patterns);
+	this->predicates = std::move(predicates);
+}
+
+std::vector<sink_filter> filter_chain::get_filters(void) const noexcept(false)
+{
+	std::vector<sink_filter> filters = std::vector<sink_filter>(predicates.size());
+
+	assert(nullptr != this);
+
+	for (const predicate& predicate : predicates)
+	{
+		filters[predicate.index] = { predicate.target, std::string_view{ patterns }.substr(predicate.offset, predicate.length), predicate.exclude };
+	}
+
+	return filters;
+}
+
+bool filter_chain::passes(const record& record) const noexcept
+{
+	assert(nullptr != this);
+
+	for (const predicate& predicate : predicates)
+	{
+		if (predicate.exclude == predicate.match(record, std::string_view{ patterns }.substr(predicate.offset, predicate.length)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+static bool match_file(const record& record, const std::string_view pattern) noexcept
+{
+	return record.callsite->file_path.starts_with(pattern);
+}
+
+static bool match_function(const record& record, const std::string_view pattern) noexcept
+{
+	return record.callsite->function_name.starts_with(pattern);
+}
+
+static bool match_category(const record& record, const std::string_view pattern) noexcept
+{
+	if (true == pattern.empty())
+	{
+		return true;
+	}
+
+	// A category sharing only the prefix (e.g. "net2" for "net") is not a descendant.
+	return true == record.category.starts_with(pattern) && (record.category.length() == pattern.length() || '.' == record.category[pattern.length()]);
+}
+
+static bool match_thread(const record& record, const std::string_view pattern) noexcept
+{
+	return true == record.thread_name.starts_with(pattern) || pattern == record.thread_id;
+}
+
+static bool match_message(const record& record, const std::string_view pattern) noexcept
+{
+	static thread_local std::string message = "";
+
+	if (nullptr == record.decode && false == record.is_structured)
+	{
+		return std::string_view::npos != record.arguments.find(pattern);
+	}
+
+	try
+	{
+		message.clear();
+		record.format_message(message);
+	}
+	catch (const std::exception& exception)
+	{
+		DEBUG_PRINT("Caught exception while formatting message to be filtered! (error message: \"{}\")", exception.what());
+		return true;
+	}
+
+	return std::string::npos != message.find(pattern);
+}
+
+} /*< namespace hob::log */
@@ -38,6 +38,12 @@
 #include "logger.hpp"
 #include "sink_manager.hpp"
 #include "sink_terminal.hpp"
+#include "process.hpp"
+#include "thread_info.hpp"
+#include "clock.hpp"
+#include "callsite_registry.hpp"
+#include "category_registry.hpp"
+#include "backend.hpp"
 #include "utility.hpp"
 
 /******************************************************************************************************
@@ -54,6 +60,12 @@ namespace hob::log
  *****************************************************************************************************/
 static std::unique_ptr<sink_manager> logger = nullptr;
 
+/******************************************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************************************/
+
+constinit std::atomic<std::uint8_t> details::severity_mask = 0U;
+
 /******************************************************************************************************
  * LOCAL FUNCTIONS
  *****************************************************************************************************/
@@ -66,6 +78,54 @@ static std::unique_ptr<sink_manager> logger = nullptr;
  *****************************************************************************************************/
 static sink_manager& get_logger(void) noexcept(false);
 
+/** ***************************************************************************************************
+ * @brief Makes the record of a message, capturing the identifier, the name and the context of the
+ * calling thread. It is thread-safe.
+ * @param callsite: The description of the place where the message has been logged.
+ * @param suppressed_count: The number of calls of the call site dropped since the previous one.
+ * @param format: String that contains the text to be written.
+ * @param decode: The function formatting the encoded arguments (nullptr if they are the message).
+ * @param arguments: The encoded arguments, the message or the encoded fields.
+ * @param is_structured: The arguments are encoded key-value fields.
+ * @param category: The path of the category (empty if logged by sink name).
+ * @returns The record.
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static record capture(const details::callsite* callsite,
+									std::uint64_t			 suppressed_count,
+									std::string_view		 format,
+									details::decoder		 decode,
+									std::string_view		 arguments,
+									bool					 is_structured,
+									std::string_view		 category) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Counts the message for its call site. It is thread-safe.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void count(const record& record) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Counts the message for its call site and sends it to the sink. It is thread-safe.
+ * @param sink_name: The name of the name the message will be sent to.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void send(std::string_view sink_name, const record& record) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Counts the message for its call site and sends it to the sinks of a routing table. It is
+ * thread-safe.
+ * @param sinks: The bitset of the indices of the sinks the message will be sent to.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void send(std::uint64_t sinks, const record& record) noexcept;
+
 /******************************************************************************************************
  * FUNCTION DEFINITIONS
  *****************************************************************************************************/
@@ -79,6 +139,85 @@ void initialize(const std::string_view configuration_file_path) noexcept(false)
 {
 	logger =
 		false == is_initialized() ? std::make_unique<sink_manager>(configuration_file_path) : throw std::logic_error{ "The logger has already been initialized!" };
+
+	process::refresh();
+	process::register_fork_handler();
+	clock::calibrate();
+}
+
+void deinitialize(void) noexcept
+{
+	logger = nullptr;
+}
+
+void refresh_host_name(void) noexcept
+{
+	process::refresh();
+}
+
+void set_thread_name(const std::string_view thread_name) noexcept(false)
+{
+	thread_info::set_thread_name(thread_name);
+}
+
+void set_callsites_enabled(const callsite_filter& filter, const bool enabled) noexcept(false)
+{
+	callsite_registry::add_rule(filter, enabled);
+}
+
+void reset_callsites(void) noexcept
+{
+	callsite_registry::clear_rules();
+}
+
+category_handle get_category(const std::string_view name) noexcept(false)
+{
+	return category_registry::get(name);
+}
+
+void set_category_level(const std::string_view name, const std::uint8_t severity_level) noexcept(false)
+{
+	category_registry::set_level(name, severity_level);
+}
+
+void reset_category_level(const std::string_view name) noexcept(false)
+{
+	category_registry::reset_level(name);
+}
+
+void set_category_sink(const std::string_view name, const std::string_view sink_name) noexcept(false)
+{
+	category_registry::set_sink(name, sink_name);
+}
+
+void reset_category_sink(const std::string_view name) noexcept(false)
+{
+	category_registry::reset_sink(name);
+}
+
+void add_route(const std::string_view name, const std::uint8_t severity_level, const std::string_view sink_name) noexcept(false)
+{
+	category_registry::add_route(name, severity_level, sink_name);
+}
+
+void clear_routes(void) noexcept
+{
+	category_registry::clear_routes();
+}
+
+std::vector<callsite_statistics> get_noisiest_callsites(const std::size_t count) noexcept(false)
+{
+	return callsite_registry::get_statistics(count);
+}
+
+void set_backend_thread_count(const std::size_t count) noexcept(false)
+{
+	backend::set_thread_count(count);
+}
+
+std::size_t get_backend_thread_count(void) noexcept
+{
+	return backend::get_thread_count();
 }
 
 void add_sink(const std::string_view sink_name, const sink_terminal_configuration& configuration) noexcept(false)
@@ -86,6 +225,11 @@ void add_sink(const std::string_view sink_name, const sink_terminal_configuratio
 	get_logger().add_sink(sink_name, configuration);
 }
 
+void add_sink(const std::string_view sink_name, const sink_json_configuration& configuration) noexcept(false)
+{
+	get_logger().add_sink(sink_name, configuration);
+}
+
 void add_sink(const std::string_view sink_name, const std::list<std::string>& sink_names) noexcept(false)
 {
 	get_logger().add_sink(sink_name, sink_names);
@@ -115,7 +259,10 @@ std::string_view get_default_sink_name(void) noexcept(false)
 
 void set_format(const std::string_view sink_name, const std::string_view format) noexcept(false)
 {
-	get_logger().get_sink<sink_base>(sink_name).set_format(format);
+	sink_manager& manager = get_logger();
+
+	manager.get_sink<sink_base>(sink_name).set_format(format);
+	manager.on_configuration_changed();
 }
 
 std::string_view get_format(const std::string_view sink_name) noexcept(false)
@@ -125,7 +272,10 @@ std::string_view get_format(const std::string_view sink_name) noexcept(false)
 
 void set_time_format(const std::string_view sink_name, const std::string_view time_format) noexcept(false)
 {
-	get_logger().get_sink<sink_base>(sink_name).set_time_format(time_format);
+	sink_manager& manager = get_logger();
+
+	manager.get_sink<sink_base>(sink_name).set_time_format(time_format);
+	manager.on_configuration_changed();
 }
 
 std::string_view get_time_format(const std::string_view sink_name) noexcept(false)
@@ -135,7 +285,10 @@ std::string_view get_time_format(const std::string_view sink_name) noexcept(fals
 
 void set_severity_level(const std::string_view sink_name, const std::uint8_t severity_level) noexcept(false)
 {
-	get_logger().get_sink<sink_base>(sink_name).set_severity_level(severity_level);
+	sink_manager& manager = get_logger();
+
+	manager.get_sink<sink_base>(sink_name).set_severity_level(severity_level);
+	manager.on_configuration_changed();
 }
 
 std::uint8_t get_severity_level(const std::string_view sink_name) noexcept(false)
@@ -143,6 +296,42 @@ std::uint8_t get_severity_level(const std::string_view sink_name) noexcept(false
 	return get_logger().get_sink<sink_base>(sink_name).get_severity_level();
 }
 
+void set_timestamp_source(const std::string_view sink_name, const timestamp_source source) noexcept(false)
+{
+	sink_manager& manager = get_logger();
+
+	manager.get_sink<sink_base>(sink_name).set_timestamp_source(source);
+	manager.on_configuration_changed();
+}
+
+timestamp_source get_timestamp_source(const std::string_view sink_name) noexcept(false)
+{
+	return get_logger().get_sink<sink_base>(sink_name).get_timestamp_source();
+}
+
+void set_collapse_timeout(const std::string_view sink_name, const std::uint32_t timeout) noexcept(false)
+{
+	sink_manager& manager = get_logger();
+
+	manager.get_sink<sink_base>(sink_name).set_collapse_timeout(timeout);
+	manager.on_configuration_changed();
+}
+
+std::uint32_t get_collapse_timeout(const std::string_view sink_name) noexcept(false)
+{
+	return get_logger().get_sink<sink_base>(sink_name).get_collapse_timeout();
+}
+
+void set_filters(const std::string_view sink_name, const std::vector<sink_filter>& filters) noexcept(false)
+{
+	get_logger().get_sink<sink_base>(sink_name).set_filters(filters);
+}
+
+std::vector<sink_filter> get_filters(const std::string_view sink_name) noexcept(false)
+{
+	return get_logger().get_sink<sink_base>(sink_name).get_filters();
+}
+
 void set_stream(const std::string_view sink_name, FILE* const stream) noexcept(false)
 {
 	get_logger().get_sink<sink_terminal>(sink_name).set_stream(stream);
@@ -166,17 +355,83 @@ bool get_color(const std::string_view sink_name) noexcept(false)
 namespace details
 {
 
-void log(const std::string_view sink_name,
-		 const std::uint8_t		severity_bit,
-		 const std::string_view tag,
-		 const std::string_view file_path,
-		 const std::string_view function_name,
-		 const std::int32_t		line,
-		 const std::string_view message) noexcept
+void log_message(const std::string_view sink_name,
+				 const callsite* const	callsite,
+				 const std::uint64_t	suppressed_count,
+				 const std::string_view format,
+				 const decoder			decode,
+				 const std::string_view arguments) noexcept
+{
+	send(sink_name, capture(callsite, suppressed_count, format, decode, arguments, false, ""));
+}
+
+void log_message(const category_handle	category,
+				 const callsite* const	callsite,
+				 const std::uint64_t	suppressed_count,
+				 const std::string_view format,
+				 const decoder			decode,
+				 const std::string_view arguments) noexcept
+{
+	send(category->get_routes(callsite->severity_bit), capture(callsite, suppressed_count, format, decode, arguments, false, category->name));
+}
+
+void log_fields_message(const std::string_view sink_name,
+						const callsite* const  callsite,
+						const std::string_view message,
+						const std::string_view fields) noexcept
+{
+	send(sink_name, capture(callsite, 0UL, message, nullptr, fields, true, ""));
+}
+
+std::string& get_message_buffer(void) noexcept
+{
+	static thread_local std::string message = "";
+	return message;
+}
+
+context& get_context(void) noexcept
 {
+	static thread_local context context = {};
+	return context;
+}
+
+} /*< namespace details */
+
+static sink_manager& get_logger(void) noexcept(false)
+{
+	return true == is_initialized() ? *logger : throw std::logic_error{ "The logger has NOT been initialized successfully!" };
+}
+
+static record capture(const details::callsite* const callsite,
+					  const std::uint64_t			 suppressed_count,
+					  const std::string_view		 format,
+					  const details::decoder		 decode,
+					  const std::string_view		 arguments,
+					  const bool					 is_structured,
+					  const std::string_view		 category) noexcept
+{
+	const details::context& context = details::get_context();
+
+	return { callsite, suppressed_count, 0UL, thread_info::get_thread_id(), thread_info::get_thread_name(), format, decode, arguments, is_structured, category,
+			 context.text, context.fields };
+}
+
+static void count(const record& record) noexcept
+{
+	(void)record.callsite->messages_count.fetch_add(1UL, std::memory_order_relaxed);
+	if (0UL != record.suppressed_count)
+	{
+		(void)record.callsite->dropped_count.fetch_add(record.suppressed_count, std::memory_order_relaxed);
+	}
+}
+
+static void send(const std::string_view sink_name, const record& record) noexcept
+{
+	count(record);
+
 	try
 	{
-		get_logger().get_sink<sink>(sink_name).log(severity_bit, tag, file_path, function_name, line, message);
+		get_logger().get_sink<sink>(sink_name).log(record);
 	}
 	catch (const std::invalid_argument& exception)
 	{
@@ -188,11 +443,18 @@ void log(const std::string_view sink_name,
 	}
 }
 
-} /*< namespace details */
-
-static sink_manager& get_logger(void) noexcept(false)
+static void send(const std::uint64_t sinks, const record& record) noexcept
 {
-	return true == is_initialized() ? *logger : throw std::logic_error{ "The logger has NOT been initialized successfully!" };
+	count(record);
+
+	try
+	{
+		get_logger().log(sinks, record);
+	}
+	catch (const std::logic_error& exception)
+	{
+		DEBUG_PRINT("Caught std::logic_error while sending message to the logger! (error message: \"{}\")", exception.what());
+	}
 }
 
 } /*< namespace hob::log */
@@ -0,0 +1,318 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file merging_queue.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the class defined in merging_queue.hpp.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <algorithm>
+
+#include "merging_queue.hpp"
+#include "clock.hpp"
+#include "utility.hpp"
+
+namespace hob::log
+{
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The queue a thread has registered with a merging queue.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL registration final
+{
+	std::uint64_t				  owner; /**< The identifier of the merging queue.	*/
+	std::shared_ptr<thread_queue> queue; /**< The queue of the thread.				*/
+};
+
+/** ***************************************************************************************************
+ * @brief The queues of a thread, closed when the thread exits so the consumers release them.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL thread_registrations final
+{
+	/** ***********************************************************************************************
+	 * @brief Closes the queues of the exiting thread.
+	 * @param void
+	 * @throws N/A.
+	 *************************************************************************************************/
+	~thread_registrations(void) noexcept
+	{
+		for (const registration& registration : registrations)
+		{
+			registration.queue->close();
+		}
+	}
+
+	std::vector<registration> registrations; /**< One per merging queue the thread has logged to. */
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many merging queues have been created (the next identifier).
+ *****************************************************************************************************/
+static constinit std::atomic<std::uint64_t> identifiers_count = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The queues the calling thread has registered with the merging queues it has logged to.
+ *****************************************************************************************************/
+static thread_local thread_registrations current_thread_registrations = {};
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+merging_queue::merging_queue(const std::size_t capacity, const timestamp_source clock) noexcept
+	: identifier{ identifiers_count.fetch_add(1UL, std::memory_order_relaxed) }
+	, capacity{ capacity }
+	, clock{ clock }
+	, registration_mutex{}
+	, registered_queues{}
+	, registrations_count{ 0UL }
+	, adoptions_count{ 0UL }
+	, queues{}
+	, front_queue{ nullptr }
+{
+}
+
+merging_queue::~merging_queue(void) noexcept
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ registration_mutex };
+
+	for (const std::shared_ptr<thread_queue>& queue : queues)
+	{
+		queue->abandon();
+	}
+
+	for (const std::shared_ptr<thread_queue>& queue : registered_queues)
+	{
+		queue->abandon();
+	}
+}
+
+bool merging_queue::is_empty(void) const noexcept
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ registration_mutex };
+
+	assert(nullptr != this);
+
+	return std::ranges::all_of(queues, [](const std::shared_ptr<thread_queue>& queue) -> bool { return queue->is_empty(); })
+		&& std::ranges::all_of(registered_queues, [](const std::shared_ptr<thread_queue>& queue) -> bool { return queue->is_empty(); });
+}
+
+bool merging_queue::emplace(const record& record) noexcept
+{
+	assert(nullptr != this);
+
+	try
+	{
+		return get_thread_queue().emplace(record, 0UL != record.timestamp ? record.timestamp : clock::read(clock));
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while creating the queue of the thread! (error message: \"{}\")", exception.what());
+	}
+
+	return false;
+}
+
+bool merging_queue::emplace(const details::callsite* const callsite, const std::shared_ptr<const std::string>& line) noexcept
+{
+	assert(nullptr != this);
+
+	try
+	{
+		return get_thread_queue().emplace(callsite, line, clock::read(clock));
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while creating the queue of the thread! (error message: \"{}\")", exception.what());
+	}
+
+	return false;
+}
+
+const stored_record* merging_queue::front(void) noexcept
+{
+	std::uint64_t next_key = 0UL;
+
+	assert(nullptr != this);
+
+	adopt();
+
+	front_queue = find_earliest(next_key);
+	return nullptr != front_queue ? front_queue->front() : nullptr;
+}
+
+void merging_queue::pop(void) noexcept
+{
+	assert(nullptr != this);
+	assert(nullptr != front_queue);
+
+	front_queue->pop();
+	front_queue = nullptr;
+}
+
+std::size_t merging_queue::front(const std::span<const stored_record*> records) noexcept
+{
+	std::uint64_t next_key = 0UL;
+
+	assert(nullptr != this);
+
+	adopt();
+
+	front_queue = find_earliest(next_key);
+	return nullptr != front_queue ? front_queue->front(records, next_key) : 0UL;
+}
+
+void merging_queue::pop(const std::size_t count) noexcept
+{
+	assert(nullptr != this);
+	assert(nullptr != front_queue || 0UL == count);
+
+	if (nullptr != front_queue)
+	{
+		front_queue->pop(count);
+		front_queue = nullptr;
+	}
+}
+
+thread_queue& merging_queue::get_thread_queue(void) noexcept(false)
+{
+	std::vector<registration>&	  registrations = current_thread_registrations.registrations;
+	std::shared_ptr<thread_queue> queue			= nullptr;
+
+	assert(nullptr != this);
+
+	// The queues of the consumers that are gone (destroyed or synchronous sinks) are released as soon as the thread logs again.
+	(void)std::erase_if(registrations, [](const registration& registration) -> bool { return registration.queue->is_abandoned(); });
+
+	for (const registration& registration : registrations)
+	{
+		if (identifier == registration.owner)
+		{
+			return *registration.queue;
+		}
+	}
+
+	queue = std::make_shared<thread_queue>(capacity);
+	registrations.reserve(registrations.size() + 1UL);
+	{
+		std::lock_guard<std::mutex> lock = std::lock_guard{ registration_mutex };
+
+		registered_queues.push_back(queue);
+		(void)registrations_count.fetch_add(1UL, std::memory_order_seq_cst);
+	}
+	registrations.push_back({ identifier, queue });
+
+	return *queue;
+}
+
+void merging_queue::adopt(void) noexcept
+{
+	assert(nullptr != this);
+
+	if (adoptions_count == registrations_count.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock = std::lock_guard{ registration_mutex };
+
+	try
+	{
+		queues.reserve(queues.size() + registered_queues.size());
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while adopting the queues of the threads! (error message: \"{}\")", exception.what());
+		return;
+	}
+
+	for (std::shared_ptr<thread_queue>& queue : registered_queues)
+	{
+		queues.push_back(std::move(queue));
+	}
+
+	registered_queues.clear();
+	adoptions_count = registrations_count.load(std::memory_order_relaxed);
+}
+
+thread_queue* merging_queue::find_earliest(std::uint64_t& next_key) noexcept
+{
+	thread_queue* earliest_queue = nullptr;
+	std::uint64_t earliest_key	 = UINT64_MAX;
+	bool		  is_closed		 = false;
+
+	assert(nullptr != this);
+
+	next_key = UINT64_MAX;
+
+	for (std::size_t index = 0UL; index < queues.size();)
+	{
+		thread_queue& queue = *queues[index];
+
+		// Read before checking for records, so the last one emplaced before the thread exited is not missed.
+		is_closed = queue.is_closed();
+
+		if (nullptr == queue.front())
+		{
+			if (true == is_closed)
+			{
+				queues[index] = std::move(queues.back());
+				queues.pop_back();
+				continue;
+			}
+
+			++index;
+			continue;
+		}
+
+		if (nullptr == earliest_queue || queue.get_front_key() < earliest_key)
+		{
+			next_key	   = earliest_key;
+			earliest_queue = &queue;
+			earliest_key   = queue.get_front_key();
+		}
+		else
+		{
+			next_key = std::min(next_key, queue.get_front_key());
+		}
+
+		++index;
+	}
+
+	return earliest_queue;
+}
+
+} /*< namespace hob::log */
@@ -0,0 +1,260 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file message_formatter.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the class defined in message_formatter.hpp.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <charconv>
+
+#include "message_formatter.hpp"
+#include "process.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The mandatory substring that will be substitued for the message inside the log.
+ *****************************************************************************************************/
+static constexpr std::string_view FORMAT_SPECIFIER_MESSAGE = "{MESSAGE}";
+
+/** ***************************************************************************************************
+ * @brief The placeholders that are recognized inside a message format and their operations.
+ *****************************************************************************************************/
+static constexpr std::array<std::pair<std::string_view, message_formatter::field>, 12UL> MESSAGE_PLACEHOLDERS = {
+	std::pair{ "{TIME}", message_formatter::field::TIME },
+	std::pair{ "{TAG}", message_formatter::field::TAG },
+	std::pair{ "{FILE:long}", message_formatter::field::FILE_LONG },
+	std::pair{ "{FILE:short}", message_formatter::field::FILE_SHORT },
+	std::pair{ "{FUNCTION}", message_formatter::field::FUNCTION },
+	std::pair{ "{LINE}", message_formatter::field::LINE },
+	std::pair{ "{HOST}", message_formatter::field::HOST },
+	std::pair{ "{PID}", message_formatter::field::PID },
+	std::pair{ "{THREAD}", message_formatter::field::THREAD },
+	std::pair{ "{THREAD_NAME}", message_formatter::field::THREAD_NAME },
+	std::pair{ FORMAT_SPECIFIER_MESSAGE, message_formatter::field::MESSAGE },
+	std::pair{ "{CONTEXT}", message_formatter::field::CONTEXT }
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gets the bit corresponding to a field inside the fields mask.
+ * @param field: The field whose bit is requested.
+ * @returns The bit of the field.
+ * @throws N/A.
+ *****************************************************************************************************/
+static constexpr std::uint32_t get_field_bit(message_formatter::field field) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Appends the decimal representation of an integer to the destination. It is thread-safe.
+ * @param destination: The string the number will be appended to.
+ * @param value: The number to be appended.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+static void append_integer(std::string& destination, std::int64_t value) noexcept(false);
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+message_formatter::message_formatter(void) noexcept
+	: source{}
+	, tokens{}
+	, fields_mask{ 0U }
+{
+}
+
+void message_formatter::compile(const std::string_view format) noexcept(false)
+{
+	std::vector<token> tokens		 = {};
+	std::uint32_t	   fields_mask	 = 0U;
+	std::size_t		   literal_begin = 0UL;
+	std::size_t		   position		 = 0UL;
+
+	assert(nullptr != this);
+
+	while (std::string_view::npos != (position = format.find('{', position)))
+	{
+		const auto placeholder = std::find_if(MESSAGE_PLACEHOLDERS.begin(),
+											  MESSAGE_PLACEHOLDERS.end(),
+											  [format, position](const std::pair<std::string_view, field>& placeholder)
+											  { return format.substr(position).starts_with(placeholder.first); });
+		if (MESSAGE_PLACEHOLDERS.end() == placeholder)
+		{
+			++position;
+			continue;
+		}
+
+		if (literal_begin < position)
+		{
+			tokens.push_back(token{ field::LITERAL, literal_begin, position - literal_begin });
+		}
+
+		tokens.push_back(token{ placeholder->second, 0UL, 0UL });
+		fields_mask |= get_field_bit(placeholder->second);
+
+		position += placeholder->first.length();
+		literal_begin = position;
+	}
+
+	if (literal_begin < format.length())
+	{
+		tokens.push_back(token{ field::LITERAL, literal_begin, format.length() - literal_begin });
+	}
+
+	if (0U == (fields_mask & get_field_bit(field::MESSAGE)))
+	{
+		throw std::invalid_argument{ std::format("Format's mandatory \"{}\" field is missing!", FORMAT_SPECIFIER_MESSAGE) };
+	}
+
+	source			  = format;
+	this->tokens	  = std::move(tokens);
+	this->fields_mask = fields_mask;
+}
+
+std::string_view message_formatter::get_format(void) const noexcept
+{
+	assert(nullptr != this);
+	return source;
+}
+
+bool message_formatter::contains(const field field) const noexcept
+{
+	assert(nullptr != this);
+	return 0U != (fields_mask & get_field_bit(field));
+}
+
+void message_formatter::format(std::string& destination, const message_fields& fields) const noexcept(false)
+{
+	assert(nullptr != this);
+	assert(false == tokens.empty());
+
+	for (const token& token : tokens)
+	{
+		switch (token.type)
+		{
+			case field::LITERAL:
+			{
+				(void)destination.append(source, token.offset, token.length);
+				break;
+			}
+			case field::TIME:
+			{
+				(void)destination.append(fields.time);
+				break;
+			}
+			case field::TAG:
+			{
+				(void)destination.append(fields.tag);
+				break;
+			}
+			case field::FILE_LONG:
+			{
+				(void)destination.append(fields.file_path);
+				break;
+			}
+			case field::FILE_SHORT:
+			{
+				(void)destination.append(fields.file_name);
+				break;
+			}
+			case field::FUNCTION:
+			{
+				(void)destination.append(fields.function_name);
+				break;
+			}
+			case field::LINE:
+			{
+				append_integer(destination, fields.line);
+				break;
+			}
+			case field::HOST:
+			{
+				(void)destination.append(process::get_host_name());
+				break;
+			}
+			case field::PID:
+			{
+				(void)destination.append(process::get_process_id());
+				break;
+			}
+			case field::THREAD:
+			{
+				(void)destination.append(fields.thread_id);
+				break;
+			}
+			case field::THREAD_NAME:
+			{
+				(void)destination.append(fields.thread_name);
+				break;
+			}
+			case field::MESSAGE:
+			{
+				(void)destination.append(fields.message);
+				break;
+			}
+			case field::CONTEXT:
+			{
+				(void)destination.append(fields.context);
+				break;
+			}
+		}
+	}
+}
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+static constexpr std::uint32_t get_field_bit(const message_formatter::field field) noexcept
+{
+	return 1U << static_cast<std::uint32_t>(field);
+}
+
+static void append_integer(std::string& destination, const std::int64_t value) noexcept(false)
+{
+	std::array<char, 20UL>	   buffer = {};
+	const std::to_chars_result result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+
+	assert(std::errc{} == result.ec);
+	(void)destination.append(buffer.data(), result.ptr);
+}
+
+} /*< namespace hob::log */
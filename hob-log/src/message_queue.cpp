@@ -30,6 +30,9 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <bit>
+#include <algorithm>
+
 #include "message_queue.hpp"
 #include "utility.hpp"
 
@@ -40,62 +43,192 @@
 namespace hob::log
 {
 
-bool message_queue::is_empty(void) const noexcept
+message_queue::message_queue(const std::size_t capacity) noexcept(false)
+	: slots{ std::make_unique<slot[]>(std::bit_ceil(std::max(capacity, 2UL))) }
+	, mask{ std::bit_ceil(std::max(capacity, 2UL)) - 1UL }
+	, enqueue_position{ 0UL }
+	, dequeue_position{ 0UL }
 {
-	std::lock_guard<std::mutex> lock = std::lock_guard{ mutex };
+	for (std::uint64_t position = 0UL; position <= mask; ++position)
+	{
+		slots[position].sequence.store(position, std::memory_order_relaxed);
+	}
+}
 
+std::size_t message_queue::get_capacity(void) const noexcept
+{
 	assert(nullptr != this);
-	return queue.empty();
+	return mask + 1UL;
 }
 
-bool message_queue::emplace(const std::uint8_t severity_bit, std::string&& message) noexcept
+bool message_queue::is_empty(void) const noexcept
 {
-	std::lock_guard<std::mutex> lock = std::lock_guard{ mutex };
+	assert(nullptr != this);
+	return false == is_ready();
+}
+
+bool message_queue::emplace(const record& record) noexcept
+{
+	slot* const slot	  = claim();
+	bool		is_copied = false;
 
 	assert(nullptr != this);
 
-	try
+	if (nullptr == slot)
 	{
-		(void)queue.emplace(severity_bit, std::move(message));
-		condition_notifier.notify_one();
+		return false;
+	}
 
-		return true;
+	try
+	{
+		slot->record.assign(record);
+		is_copied = true;
 	}
 	catch (const std::bad_alloc& exception)
 	{
 		DEBUG_PRINT("Caught std::bad_alloc while emplacing message into queue! (error message: \"{}\")", exception.what());
+	}
+
+	/* The slot belongs to the consumer once it is published, so it is not read afterwards. */
+	slot->is_lost = false == is_copied;
+	publish(*slot);
+
+	return is_copied;
+}
+
+bool message_queue::emplace(const details::callsite* const callsite, const std::shared_ptr<const std::string>& line) noexcept
+{
+	slot* const slot = claim();
+
+	assert(nullptr != this);
+
+	if (nullptr == slot)
+	{
 		return false;
 	}
+
+	slot->record.assign(callsite, line);
+	slot->is_lost = false;
+
+	publish(*slot);
+	return true;
 }
 
-std::optional<message_queue::payload> message_queue::pop(void) noexcept
+const stored_record* message_queue::front(void) noexcept
 {
-	payload						 message = { 0U, "" };
-	std::unique_lock<std::mutex> lock	 = std::unique_lock{ mutex };
+	assert(nullptr != this);
+
+	while (true == is_ready())
+	{
+		const slot& slot = slots[dequeue_position & mask];
+
+		if (false == slot.is_lost)
+		{
+			return &slot.record;
+		}
+
+		pop();
+	}
+
+	return nullptr;
+}
+
+void message_queue::pop(void) noexcept
+{
+	slot& slot = slots[dequeue_position & mask];
+
+	assert(nullptr != this);
+	assert(true == is_ready());
+
+	slot.record.release();
+	slot.sequence.store(dequeue_position + mask + 1UL, std::memory_order_release);
+	++dequeue_position;
+}
+
+std::size_t message_queue::front(const std::span<const stored_record*> records) noexcept
+{
+	std::uint64_t position = dequeue_position;
+	std::size_t	  count	   = 0UL;
 
 	assert(nullptr != this);
 
-	if (true == queue.empty())
+	while (count < records.size() && position + 1UL == slots[position & mask].sequence.load(std::memory_order_acquire))
 	{
-		condition_notifier.wait(lock);
-		if (true == queue.empty())
+		const slot& slot = slots[position & mask];
+
+		if (true == slot.is_lost)
 		{
-			return std::nullopt;
+			// A lost record at the beginning is skipped, one in the middle ends the range.
+			if (0UL != count)
+			{
+				break;
+			}
+
+			pop();
+			++position;
+			continue;
 		}
+
+		records[count] = &slot.record;
+		++count;
+		++position;
+	}
+
+	return count;
+}
+
+void message_queue::pop(const std::size_t count) noexcept
+{
+	assert(nullptr != this);
+
+	for (std::size_t index = 0UL; index < count; ++index)
+	{
+		pop();
 	}
+}
 
-	message = queue.front();
-	queue.pop();
+message_queue::slot* message_queue::claim(void) noexcept
+{
+	std::uint64_t position = enqueue_position.load(std::memory_order_relaxed);
+	std::uint64_t sequence = 0UL;
+	slot*		  slot	   = nullptr;
+
+	assert(nullptr != this);
 
-	return std::optional<payload>{ std::move(message) };
+	while (true)
+	{
+		slot	 = &slots[position & mask];
+		sequence = slot->sequence.load(std::memory_order_acquire);
+
+		if (sequence == position)
+		{
+			if (true == enqueue_position.compare_exchange_weak(position, position + 1UL, std::memory_order_relaxed))
+			{
+				return slot;
+			}
+		}
+		else if (sequence < position)
+		{
+			return nullptr;
+		}
+		else
+		{
+			position = enqueue_position.load(std::memory_order_relaxed);
+		}
+	}
 }
 
-void message_queue::interrupt_wait(void) noexcept
+void message_queue::publish(slot& slot) noexcept
 {
-	std::lock_guard<std::mutex> lock = std::lock_guard{ mutex };
+	assert(nullptr != this);
+
+	slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1UL, std::memory_order_release);
+}
 
+bool message_queue::is_ready(void) const noexcept
+{
 	assert(nullptr != this);
-	condition_notifier.notify_one();
+	return dequeue_position + 1UL == slots[dequeue_position & mask].sequence.load(std::memory_order_acquire);
 }
 
 } /*< namespace hob::log */
@@ -0,0 +1,98 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file notifier.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the class defined in notifier.hpp.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include "notifier.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+notifier::notifier(void) noexcept
+	: is_waiting{ false }
+	, wake_count{ 0U }
+{
+}
+
+void notifier::notify(void) noexcept
+{
+	assert(nullptr != this);
+
+	// Pairs with the fence of prepare_wait(): either the consumer sees the message or it is seen waiting.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (true == is_waiting.load(std::memory_order_relaxed) && true == is_waiting.exchange(false, std::memory_order_seq_cst))
+	{
+		(void)wake_count.fetch_add(1U, std::memory_order_seq_cst);
+		wake_count.notify_one();
+	}
+}
+
+std::uint32_t notifier::prepare_wait(void) noexcept
+{
+	const std::uint32_t wake_value = wake_count.load(std::memory_order_seq_cst);
+
+	assert(nullptr != this);
+
+	is_waiting.store(true, std::memory_order_seq_cst);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	return wake_value;
+}
+
+void notifier::wait(const std::uint32_t wake_value) noexcept
+{
+	assert(nullptr != this);
+
+	wake_count.wait(wake_value, std::memory_order_seq_cst);
+	is_waiting.store(false, std::memory_order_relaxed);
+}
+
+void notifier::cancel_wait(void) noexcept
+{
+	assert(nullptr != this);
+	is_waiting.store(false, std::memory_order_relaxed);
+}
+
+void notifier::interrupt(void) noexcept
+{
+	assert(nullptr != this);
+
+	(void)wake_count.fetch_add(1U, std::memory_order_seq_cst);
+	wake_count.notify_one();
+}
+
+} /*< namespace hob::log */
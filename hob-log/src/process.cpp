@@ -0,0 +1,214 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file process.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @details The values are stored in fixed size buffers so that refreshing them in the child process
+ * after fork() does not need to allocate memory. The published values are never rewritten while
+ * other threads can read them: a refresh that finds different values publishes a new copy, the
+ * previous one being kept alive for the readers still viewing it.
+ * @todo N/A.
+ * @bug gethostname() and pthread_atfork() are being used, which enforces the platform to be POSIX.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "process.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The rendered values of the process-constant fields.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL process_fields final
+{
+	std::array<char, 256UL> host_name;			/**< The rendered name of the host (NUL terminated).		*/
+	std::size_t				host_name_length;	/**< The length of the rendered name of the host.			*/
+	std::array<char, 20UL>	process_id;			/**< The rendered identifier of the process.				*/
+	std::size_t				process_id_length;	/**< The length of the rendered identifier of the process.	*/
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The values read before the first refresh (empty).
+ *****************************************************************************************************/
+static process_fields initial_fields = {};
+
+/** ***************************************************************************************************
+ * @brief The values being read (never freed).
+ *****************************************************************************************************/
+static std::atomic<process_fields*> current_fields = &initial_fields;
+
+/** ***************************************************************************************************
+ * @brief Serializes the refreshes. It is held across fork() so the child does not inherit it locked.
+ *****************************************************************************************************/
+static std::mutex refresh_mutex = {};
+
+/** ***************************************************************************************************
+ * @brief Guarantees that the fork handler is registered only once (it can not be unregistered).
+ *****************************************************************************************************/
+static std::once_flag fork_handler_flag = {};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Renders the name of the host and the identifier of the process.
+ * @param fields: Where the values will be rendered.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void render_fields(process_fields& fields) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Locks the refresh mutex before fork().
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void prepare_fork(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Unlocks the refresh mutex in the parent process after fork().
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void finish_fork_parent(void) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Renders the values again in the child process after fork() and unlocks the refresh mutex.
+ * @param void
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void finish_fork_child(void) noexcept;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+void process::refresh(void) noexcept
+{
+	std::lock_guard<std::mutex> lock	  = std::lock_guard{ refresh_mutex };
+	process_fields				rendered  = {};
+	const process_fields* const published = current_fields.load(std::memory_order_relaxed);
+
+	render_fields(rendered);
+	if (std::string_view{ rendered.host_name.data(), rendered.host_name_length } == std::string_view{ published->host_name.data(), published->host_name_length }
+		&& std::string_view{ rendered.process_id.data(), rendered.process_id_length }
+			   == std::string_view{ published->process_id.data(), published->process_id_length })
+	{
+		return;
+	}
+
+	try
+	{
+		// The previous values are not freed, as a reader might still be viewing them.
+		current_fields.store(new process_fields{ rendered }, std::memory_order_release);
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while publishing the process fields! (error message: \"{}\")", exception.what());
+	}
+}
+
+void process::register_fork_handler(void) noexcept
+{
+	std::call_once(fork_handler_flag,
+				   [](void)
+				   {
+					   if (0 != pthread_atfork(&prepare_fork, &finish_fork_parent, &finish_fork_child))
+					   {
+						   DEBUG_PRINT("Failed to register the fork handler, {{PID}} will not be updated in child processes!");
+					   }
+				   });
+}
+
+std::string_view process::get_host_name(void) noexcept
+{
+	const process_fields* const current = current_fields.load(std::memory_order_acquire);
+	return { current->host_name.data(), current->host_name_length };
+}
+
+std::string_view process::get_process_id(void) noexcept
+{
+	const process_fields* const current = current_fields.load(std::memory_order_acquire);
+	return { current->process_id.data(), current->process_id_length };
+}
+
+static void render_fields(process_fields& fields) noexcept
+{
+	static constexpr std::string_view UNKNOWN_HOST_NAME = "Unknown";
+
+	const std::to_chars_result result = std::to_chars(fields.process_id.data(), fields.process_id.data() + fields.process_id.size(), getpid());
+
+	assert(std::errc{} == result.ec);
+	fields.process_id_length = static_cast<std::size_t>(result.ptr - fields.process_id.data());
+
+	if (0 != gethostname(fields.host_name.data(), fields.host_name.size() - 1UL))
+	{
+		(void)UNKNOWN_HOST_NAME.copy(fields.host_name.data(), UNKNOWN_HOST_NAME.length());
+		fields.host_name[UNKNOWN_HOST_NAME.length()] = '\0';
+	}
+
+	fields.host_name.back() = '\0';
+	fields.host_name_length = std::strlen(fields.host_name.data());
+}
+
+static void prepare_fork(void) noexcept
+{
+	refresh_mutex.lock();
+}
+
+static void finish_fork_parent(void) noexcept
+{
+	refresh_mutex.unlock();
+}
+
+static void finish_fork_child(void) noexcept
+{
+	// The child has a single thread, so the values being read can be rewritten (without allocating).
+	render_fields(*current_fields.load(std::memory_order_relaxed));
+	refresh_mutex.unlock();
+}
+
+} /*< namespace hob::log */
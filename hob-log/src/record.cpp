@@ -0,0 +1,168 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file record.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the record structure and the stored_record class.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <format>
+#include <iterator>
+#include <variant>
+
+#include "record.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+void record::format_message(std::string& destination) const noexcept(false)
+{
+	assert(nullptr != this);
+
+	if (true == is_structured)
+	{
+		format_fields(destination);
+	}
+	else if (nullptr == decode)
+	{
+		(void)destination.append(arguments);
+	}
+	else
+	{
+		decode(destination, format, arguments);
+	}
+
+	if (0UL != suppressed_count)
+	{
+		(void)std::format_to(std::back_inserter(destination), " [{} similar messages suppressed]", suppressed_count);
+	}
+}
+
+void record::format_fields(std::string& destination) const noexcept(false)
+{
+	std::string_view fields = arguments;
+
+	assert(nullptr != this);
+
+	(void)destination.append(format);
+	while (false == fields.empty())
+	{
+		const details::field field = details::deserialize_field(fields);
+
+		(void)std::format_to(std::back_inserter(destination), " {}=", field.key);
+		std::visit([&destination](const auto& value) -> void { (void)std::format_to(std::back_inserter(destination), "{}", value); }, field.value);
+	}
+}
+
+stored_record::stored_record(void) noexcept
+	: header{ nullptr, 0UL, 0UL, "", "", "", nullptr, "", false, "", "", "" }
+	, payload{}
+	, line{ nullptr }
+{
+}
+
+void stored_record::assign(const record& record) noexcept(false)
+{
+	assert(nullptr != this);
+
+	header = record;
+	line   = nullptr;
+
+	payload.clear();
+	payload.reserve(record.thread_id.length() + record.thread_name.length() + (true == record.is_structured ? record.format.length() : 0UL)
+					+ record.arguments.length() + record.context.length() + record.context_fields.length());
+	(void)payload.append(record.thread_id);
+	(void)payload.append(record.thread_name);
+
+	// Unlike a format, the message of a structured record does not need to have static storage.
+	if (true == record.is_structured)
+	{
+		(void)payload.append(record.format);
+	}
+	(void)payload.append(record.arguments);
+	(void)payload.append(record.context);
+	(void)payload.append(record.context_fields);
+}
+
+void stored_record::assign(const details::callsite* const callsite, std::shared_ptr<const std::string> line) noexcept
+{
+	assert(nullptr != this);
+	assert(nullptr != callsite);
+	assert(nullptr != line);
+
+	header	   = { callsite, 0UL, 0UL, "", "", "", nullptr, "", false, "", "", "" };
+	this->line = std::move(line);
+	payload.clear();
+}
+
+void stored_record::release(void) noexcept
+{
+	assert(nullptr != this);
+	line = nullptr;
+}
+
+record stored_record::get(void) const noexcept
+{
+	record		record = header;
+	std::size_t offset = 0UL;
+
+	assert(nullptr != this);
+
+	record.thread_id = std::string_view{ payload }.substr(offset, header.thread_id.length());
+	offset += header.thread_id.length();
+
+	record.thread_name = std::string_view{ payload }.substr(offset, header.thread_name.length());
+	offset += header.thread_name.length();
+
+	if (true == header.is_structured)
+	{
+		record.format = std::string_view{ payload }.substr(offset, header.format.length());
+		offset += header.format.length();
+	}
+
+	record.arguments = std::string_view{ payload }.substr(offset, header.arguments.length());
+	offset += header.arguments.length();
+
+	record.context = std::string_view{ payload }.substr(offset, header.context.length());
+	offset += header.context.length();
+
+	record.context_fields = std::string_view{ payload }.substr(offset);
+	return record;
+}
+
+const std::shared_ptr<const std::string>& stored_record::get_line(void) const noexcept
+{
+	assert(nullptr != this);
+	return line;
+}
+
+} /*< namespace hob::log */
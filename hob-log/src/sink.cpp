@@ -48,6 +48,10 @@ sink::sink(const std::string_view name) noexcept(false)
 	assert(false == this->name.empty());
 }
 
+void sink::on_configuration_changed(void) noexcept
+{
+}
+
 std::string_view sink::get_name(void) const noexcept
 {
 	assert(nullptr != this);
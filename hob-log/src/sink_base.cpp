@@ -22,9 +22,7 @@
  * @author Gaina Stefan
  * @date 17.11.2024
  * @brief This file implements the class defined in sink_base.hpp.
- * @todo The format and time format should not be re-evaluated each time a new message is being logged.
- * This is an efficiency optimisation, so it is not high priority for now. gethostname() is being used,
- * which enforces the platform to be POSIX.
+ * @todo N/A.
  * @bug No known bugs.
  *****************************************************************************************************/
 
@@ -33,109 +31,129 @@
  *****************************************************************************************************/
 
 #include <stdexcept>
+#include <vector>
+#include <format>
+#include <iterator>
+#include <chrono>
 #include <functional>
-#include <filesystem>
 #include <cstdint>
 #include <cinttypes>
-#include <unistd.h>
+#include <typeinfo>
+#include <system_error>
 
 #include "sink_base.hpp"
+#include "thread_info.hpp"
 #include "worker.hpp"
+#include "message_queue.hpp"
+#include "merging_queue.hpp"
+#include "clock.hpp"
 #include "utility.hpp"
 
 /******************************************************************************************************
- * CONSTANTS
+ * METHOD DEFINITIONS
  *****************************************************************************************************/
 
 namespace hob::log
 {
 
-/** ***************************************************************************************************
- * @brief The mandatory substring that will be substitued for the message inside the log.
- *****************************************************************************************************/
-static constexpr std::string_view FORMAT_SPECIFIER_MESSAGE = "{MESSAGE}";
-
-/******************************************************************************************************
- * METHOD DEFINITIONS
- *****************************************************************************************************/
-
 sink_base::sink_base(const std::string_view name, const sink_base_configuration& configuration) noexcept(false)
 	: sink{ name }
-	, format{ "" }
-	, time_format{ "" }
+	, formatter{}
+	, time_format{}
 	, severity_level{ 0U }
+	, filters{}
+	, timestamp_clock{ timestamp_source::SYSTEM }
+	, collapse_timeout{ 0U }
+	, repeat_mutex{}
+	, repeat_callsite{ nullptr }
+	, repeat_arguments{}
+	, repeat_thread_id{}
+	, repeat_thread_name{}
+	, repeat_category{}
+	, repeat_count{ 0UL }
+	, repeat_start_time{ 0L }
+	, repeat_condition{}
+	, is_repeat_watched{ false }
+	, repeat_watcher{}
+	, queue_capacity{ 0U == configuration.queue_capacity ? DEFAULT_QUEUE_CAPACITY : configuration.queue_capacity }
+	, layout{ configuration.queue }
 	, async_worker{ nullptr }
 	, lost_logs_count{ 0UL }
 {
 	set_format(configuration.format);
 	set_time_format(configuration.time_format);
 	set_severity_level(configuration.severity_level);
+	set_timestamp_source(configuration.clock);
 	set_async_mode(configuration.async_mode);
+	set_collapse_timeout(configuration.collapse_timeout);
 }
 
-sink_base::~sink_base(void) noexcept = default;
-
-void sink_base::log(const std::uint8_t	   severity_bit,
-					const std::string_view tag,
-					const std::string_view file_path,
-					const std::string_view function_name,
-					const std::int32_t	   line,
-					const std::string_view message) noexcept
+sink_base::~sink_base(void) noexcept
 {
-	std::string formatted_message = "";
+	// The concrete sink is gone, so a run still in progress (if flush_repeats() has not been called) can not be reported.
+	stop_repeat_watcher();
+}
 
+void sink_base::log(const record& record) noexcept
+{
 	assert(nullptr != this);
 
-	if (severity_bit != (severity_bit & severity_level))
+	if (false == accepts(record))
 	{
+		(void)record.callsite->filtered_count.fetch_add(1UL, std::memory_order_relaxed);
 		return;
 	}
 
-	try
-	{
-		formatted_message = format_message(tag, file_path, function_name, line, message);
-	}
-	catch (const std::bad_alloc& exception)
-	{
-		DEBUG_PRINT("Caught std::bad_alloc while formatting message! (error message: \"{}\")", exception.what());
-		lost_logs_count += UINT64_MAX > lost_logs_count ? 1UL : 0UL;
-		return;
-	}
-
-	lost_logs_count +=
-		(nullptr == async_worker ? false == log(severity_bit, formatted_message) : false == async_worker->log(severity_bit, std::move(formatted_message)))
-			? UINT64_MAX > lost_logs_count ? 1UL : 0UL
-			: 0UL;
+	log_accepted(record);
 }
 
-void sink_base::set_format(const std::string_view format) noexcept(false)
+void sink_base::log_accepted(const record& record) noexcept
 {
+	hob::log::record report		  = {};
+	bool			 is_collapsed = false;
+
 	assert(nullptr != this);
 
-	if (std::string_view::npos == format.find(FORMAT_SPECIFIER_MESSAGE))
+	if (0U != collapse_timeout.load(std::memory_order_relaxed))
 	{
-		throw std::invalid_argument{ std::format("Format's mandatory \"{}\" field is missing!", FORMAT_SPECIFIER_MESSAGE) };
+		is_collapsed = collapse(record, report);
+		if (nullptr != report.callsite)
+		{
+			submit(report);
+		}
+
+		if (true == is_collapsed)
+		{
+			(void)record.callsite->dropped_count.fetch_add(1UL, std::memory_order_relaxed);
+			return;
+		}
 	}
 
-	this->format = format;
+	submit(record);
+}
+
+void sink_base::set_format(const std::string_view format) noexcept(false)
+{
+	assert(nullptr != this);
+	formatter.compile(format);
 }
 
 std::string_view sink_base::get_format(void) const noexcept
 {
 	assert(nullptr != this);
-	return format;
+	return formatter.get_format();
 }
 
 void sink_base::set_time_format(const std::string_view time_format) noexcept(false)
 {
 	assert(nullptr != this);
-	this->time_format = time_format;
+	this->time_format.compile(time_format);
 }
 
 std::string_view sink_base::get_time_format(void) const noexcept
 {
 	assert(nullptr != this);
-	return time_format;
+	return time_format.get_format();
 }
 
 void sink_base::set_severity_level(const std::uint8_t severity_level) noexcept(false)
@@ -158,19 +176,30 @@ std::uint8_t sink_base::get_severity_level(void) const noexcept
 
 void sink_base::set_async_mode(const bool async_mode) noexcept(false)
 {
+	std::unique_ptr<log_queue> queue = nullptr;
+
 	assert(nullptr != this);
 
 	if (true == async_mode && false == get_async_mode())
 	{
-		async_worker = std::make_unique<worker>(
-			std::bind(static_cast<bool (sink_base::*)(std::uint8_t, std::string_view)>(&sink_base::log), this, std::placeholders::_1, std::placeholders::_2),
-			lost_logs_count);
+		if (queue_layout::PER_THREAD == layout)
+		{
+			queue = std::make_unique<merging_queue>(queue_capacity, timestamp_clock);
+		}
+		else
+		{
+			queue = std::make_unique<message_queue>(queue_capacity);
+		}
+
+		async_worker = std::make_unique<worker>([this](const std::span<const stored_record* const> records) -> std::size_t { return write(records); },
+												lost_logs_count,
+												std::move(queue));
 		return;
 	}
 
 	if (false == async_mode && true == get_async_mode())
 	{
-		async_worker = nullptr;
+		stop_async_worker();
 	}
 }
 
@@ -186,90 +215,548 @@ std::uint64_t sink_base::get_lost_logs(void) const noexcept
 	return lost_logs_count;
 }
 
-std::string sink_base::get_host_name(void) noexcept(false)
+void sink_base::set_timestamp_source(const timestamp_source source) noexcept
+{
+	assert(nullptr != this);
+	timestamp_clock = source;
+}
+
+timestamp_source sink_base::get_timestamp_source(void) const noexcept
+{
+	assert(nullptr != this);
+	return timestamp_clock;
+}
+
+void sink_base::set_collapse_timeout(const std::uint32_t timeout) noexcept
+{
+	assert(nullptr != this);
+
+	flush_repeats();
+	collapse_timeout.store(timeout, std::memory_order_relaxed);
+
+	if (0U != timeout)
+	{
+		start_repeat_watcher();
+	}
+}
+
+std::uint32_t sink_base::get_collapse_timeout(void) const noexcept
+{
+	assert(nullptr != this);
+	return collapse_timeout.load(std::memory_order_relaxed);
+}
+
+void sink_base::set_filters(const std::vector<sink_filter>& filters) noexcept(false)
+{
+	assert(nullptr != this);
+	this->filters.compile(filters);
+}
+
+std::vector<sink_filter> sink_base::get_filters(void) const noexcept(false)
+{
+	assert(nullptr != this);
+	return filters.get_filters();
+}
+
+bool sink_base::accepts(const record& record) const noexcept
+{
+	const std::uint8_t severity_bit = record.callsite->severity_bit;
+
+	assert(nullptr != this);
+	return severity_bit == (severity_bit & severity_level) && true == filters.passes(record);
+}
+
+bool sink_base::is_formatted_as(const sink_base& other) const noexcept
+{
+	assert(nullptr != this);
+	return typeid(*this) == typeid(other) && get_format() == other.get_format() && get_time_format() == other.get_time_format()
+		&& timestamp_clock == other.timestamp_clock && 0U == get_collapse_timeout() && 0U == other.get_collapse_timeout();
+}
+
+record sink_base::stamp(const record& record) const noexcept
+{
+	hob::log::record stamped_record = record;
+
+	assert(nullptr != this);
+
+	stamped_record.timestamp = true == is_timestamped() ? clock::read(timestamp_clock) : 0UL;
+	return stamped_record;
+}
+
+void sink_base::dispatch(const record& record, const std::string_view line, std::shared_ptr<const std::string>& shared_line) noexcept
+{
+	bool is_logged = false;
+
+	assert(nullptr != this);
+
+	if (nullptr == async_worker)
+	{
+		is_logged = output(*record.callsite, line);
+	}
+	else
+	{
+		try
+		{
+			if (nullptr == shared_line)
+			{
+				shared_line = std::make_shared<const std::string>(line);
+			}
+
+			is_logged = async_worker->log(record.callsite, shared_line);
+		}
+		catch (const std::bad_alloc& exception)
+		{
+			DEBUG_PRINT("Caught std::bad_alloc while sharing the formatted message! (error message: \"{}\")", exception.what());
+		}
+	}
+
+	count_lost_log(*record.callsite, is_logged);
+}
+
+bool sink_base::write(const record& record) noexcept
+{
+	static thread_local std::string formatted_message = "";
+
+	assert(nullptr != this);
+
+	try
+	{
+		formatted_message.clear();
+		format_message(formatted_message, record);
+	}
+	catch (const std::exception& exception)
+	{
+		DEBUG_PRINT("Caught exception while formatting message! (error message: \"{}\")", exception.what());
+		return false;
+	}
+
+	return output(*record.callsite, formatted_message);
+}
+
+bool sink_base::write(const stored_record& record) noexcept
+{
+	assert(nullptr != this);
+	return nullptr != record.get_line() ? output(*record.get().callsite, *record.get_line()) : write(record.get());
+}
+
+std::size_t sink_base::write(const std::span<const stored_record* const> records) noexcept
+{
+	static thread_local std::string							  messages	   = "";
+	static thread_local std::vector<std::size_t>			  message_ends = {};
+	static thread_local std::vector<const details::callsite*> callsites	   = {};
+	static thread_local std::vector<sink_line>				  lines		   = {};
+
+	std::size_t message_begin = 0UL;
+	std::size_t logged_count  = 0UL;
+
+	assert(nullptr != this);
+
+	try
+	{
+		messages.clear();
+		message_ends.clear();
+		callsites.clear();
+		lines.clear();
+
+		message_ends.reserve(records.size());
+		callsites.reserve(records.size());
+		lines.reserve(records.size());
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while preparing batch of messages! (error message: \"{}\")", exception.what());
+
+		for (const stored_record* const record : records)
+		{
+			count_lost_log(*record->get().callsite, write(*record));
+		}
+		return records.size();
+	}
+
+	for (const stored_record* const record : records)
+	{
+		message_begin = messages.length();
+
+		try
+		{
+			if (nullptr != record->get_line())
+			{
+				(void)messages.append(*record->get_line());
+			}
+			else
+			{
+				format_message(messages, record->get());
+			}
+		}
+		catch (const std::exception& exception)
+		{
+			DEBUG_PRINT("Caught exception while formatting message of a batch! (error message: \"{}\")", exception.what());
+
+			messages.resize(message_begin);
+			count_lost_log(*record->get().callsite, false);
+			continue;
+		}
+
+		message_ends.push_back(messages.length());
+		callsites.push_back(record->get().callsite);
+	}
+
+	// The views are taken once the messages are not being reallocated anymore.
+	message_begin = 0UL;
+	for (std::size_t index = 0UL; index < message_ends.size(); ++index)
+	{
+		lines.push_back({ callsites[index]->severity_bit, std::string_view{ messages }.substr(message_begin, message_ends[index] - message_begin) });
+		message_begin = message_ends[index];
+	}
+
+	logged_count = log_batch(lines);
+	for (std::size_t index = 0UL; index < lines.size(); ++index)
+	{
+		if (index < logged_count)
+		{
+			(void)callsites[index]->bytes_count.fetch_add(lines[index].message.length(), std::memory_order_relaxed);
+			continue;
+		}
+
+		count_lost_log(*callsites[index], false);
+	}
+
+	return records.size();
+}
+
+std::size_t sink_base::log_batch(const std::span<const sink_line> lines) noexcept
+{
+	std::size_t logged_count = 0UL;
+
+	assert(nullptr != this);
+
+	while (logged_count < lines.size() && true == log(lines[logged_count].severity_bit, lines[logged_count].message))
+	{
+		++logged_count;
+	}
+
+	return logged_count;
+}
+
+std::size_t sink_base::write_lines(FILE* const stream, const std::span<const sink_line> lines) noexcept
 {
-	std::array<char, 256UL> hostname = {};
-	return 0 == gethostname(hostname.data(), hostname.size()) ? hostname.data() : "Unknown";
+	std::size_t length		  = 0UL;
+	std::size_t written		  = 0UL;
+	std::size_t written_count = 0UL;
+
+	if (true == lines.empty())
+	{
+		return 0UL;
+	}
+
+	// The lines are stored back to back, so the batch spans from the first one to the end of the last one.
+	length = static_cast<std::size_t>(lines.back().message.data() + lines.back().message.length() - lines.front().message.data());
+
+	written = std::fwrite(lines.front().message.data(), sizeof(char), length, stream);
+	if (length == written)
+	{
+		return lines.size();
+	}
+
+	DEBUG_PRINT("Failed to write the batch of lines!");
+	while (written_count < lines.size() && lines[written_count].message.length() <= written)
+	{
+		written -= lines[written_count].message.length();
+		++written_count;
+	}
+
+	return written_count;
 }
 
-std::string sink_base::format_message(const std::string_view tag,
-									  const std::string_view file_path,
-									  const std::string_view function_name,
-									  const std::int32_t	 line,
-									  const std::string_view message) const noexcept(false)
+void sink_base::submit(const record& record) noexcept
 {
-	std::string formatted_message = format;
+	bool is_logged = false;
 
 	assert(nullptr != this);
-	assert(false == tag.empty());
-	assert(false == file_path.empty());
-	assert(false == function_name.empty());
-	assert(0 < line);
 
-	// TODO: This should not be re-evaluated everytime if there are optional fields missing, an intermediary efficient representation is needed.
-	utility::replace_placeholder(formatted_message, "{TIME}", get_formatted_time());
-	utility::replace_placeholder(formatted_message, "{TAG}", tag);
-	utility::replace_placeholder(formatted_message, "{FILE:long}", file_path);
-	utility::replace_placeholder(formatted_message, "{FILE:short}", std::filesystem::path{ file_path }.filename().string());
-	utility::replace_placeholder(formatted_message, "{FUNCTION}", function_name);
-	utility::replace_placeholder(formatted_message, "{LINE}", std::to_string(line));
-	utility::replace_placeholder(formatted_message, "{HOST}", get_host_name());
-	utility::replace_placeholder(formatted_message, "{PID}", std::to_string(getpid()));
-	utility::replace_placeholder(formatted_message, "{THREAD}", std::format("{}", std::this_thread::get_id()));
-	utility::replace_placeholder(formatted_message, FORMAT_SPECIFIER_MESSAGE, message);
+	is_logged = nullptr == async_worker ? write(stamp(record)) : async_worker->log(stamp(record));
+	count_lost_log(*record.callsite, is_logged);
+}
+
+bool sink_base::output(const details::callsite& callsite, const std::string_view line) noexcept
+{
+	assert(nullptr != this);
 
-	return std::format("{}\n", formatted_message);
+	if (false == log(callsite.severity_bit, line))
+	{
+		return false;
+	}
+
+	(void)callsite.bytes_count.fetch_add(line.length(), std::memory_order_relaxed);
+	return true;
 }
 
-std::string sink_base::get_formatted_time(void) const noexcept(false)
+void sink_base::count_lost_log(const details::callsite& callsite, const bool is_logged) noexcept
 {
-	static constexpr std::size_t								MONTHS_COUNT   = 12UL;
-	static constexpr std::size_t								WEEK_DAY_COUNT = 7UL;
-	static constexpr std::array<std::string_view, MONTHS_COUNT> MONTHS_LONG	   = {
-		   "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"
-	};
-	static constexpr std::array<std::string_view, MONTHS_COUNT> MONTHS_SHORT = {
-		"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
-	};
-	static constexpr std::array<std::string_view, WEEK_DAY_COUNT> DAY_LONG	= { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
-	static constexpr std::array<std::string_view, WEEK_DAY_COUNT> DAY_SHORT = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+	assert(nullptr != this);
+
+	if (true == is_logged)
+	{
+		return;
+	}
 
-	std::pair<std::tm*, std::int64_t> time			 = utility::get_time();
-	std::string						  formatted_time = time_format;
+	lost_logs_count += UINT64_MAX > lost_logs_count ? 1UL : 0UL;
+	(void)callsite.dropped_count.fetch_add(1UL, std::memory_order_relaxed);
+}
+
+bool sink_base::collapse(const record& record, hob::log::record& report) noexcept
+{
+	std::lock_guard<std::mutex> lock		 = std::lock_guard{ repeat_mutex };
+	const std::int64_t			current_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 
 	assert(nullptr != this);
 
-	if (nullptr == time.first)
+	if (record.callsite == repeat_callsite && record.arguments == repeat_arguments)
 	{
-		return "TIME_ERROR";
+		if (1UL == ++repeat_count)
+		{
+			repeat_condition.notify_one();
+		}
+
+		if (static_cast<std::int64_t>(collapse_timeout.load(std::memory_order_relaxed)) * 1'000'000L <= current_time - repeat_start_time)
+		{
+			report_repeats(report);
+			repeat_start_time = current_time;
+		}
+
+		return true;
 	}
 
-	assert(0 <= time.first->tm_mon && MONTHS_COUNT > time.first->tm_mon);
-	assert(0 <= time.first->tm_yday && 366 > time.first->tm_yday);
-	assert(0 <= time.first->tm_wday && WEEK_DAY_COUNT > time.first->tm_wday);
-	assert(0 <= time.first->tm_hour && 24 > time.first->tm_hour);
-	assert(0 <= time.first->tm_min && 60 > time.first->tm_min);
-	assert(0 <= time.first->tm_sec && 60 > time.first->tm_sec);
-	assert(0 <= time.second && 1000 > time.second);
+	report_repeats(report);
 
-	// TODO: This should not be re-evaluated everytime if there are optional fields missing, an intermediary efficient representation is needed.
-	utility::replace_placeholder(formatted_time, "{YEAR}", std::format("{:04}", time.first->tm_year + 1900));
-	utility::replace_placeholder(formatted_time, "{MONTH:numeric}", std::format("{:02}", time.first->tm_mon + 1));
-	utility::replace_placeholder(formatted_time, "{MONTH:long}", MONTHS_LONG[time.first->tm_mon]);
-	utility::replace_placeholder(formatted_time, "{MONTH:short}", MONTHS_SHORT[time.first->tm_mon]);
-	utility::replace_placeholder(formatted_time, "{DAY_YEAR}", std::format("{:03}", time.first->tm_yday + 1));
-	utility::replace_placeholder(formatted_time, "{DAY_MONTH}", std::format("{:02}", time.first->tm_mday));
-	utility::replace_placeholder(formatted_time, "{DAY_WEEK:numeric}", std::format("{:01}", time.first->tm_wday));
-	utility::replace_placeholder(formatted_time, "{DAY_WEEK:long}", DAY_LONG[time.first->tm_wday]);
-	utility::replace_placeholder(formatted_time, "{DAY_WEEK:short}", DAY_SHORT[time.first->tm_wday]);
-	utility::replace_placeholder(formatted_time, "{HOUR:24}", std::format("{:02}", time.first->tm_hour));
-	utility::replace_placeholder(formatted_time, "{HOUR:12}", std::format("{:02}", 0 == time.first->tm_hour ? 12 : time.first->tm_hour % 12));
-	utility::replace_placeholder(formatted_time, "{MERIDIEM}", 12 > time.first->tm_hour ? "AM" : "PM");
-	utility::replace_placeholder(formatted_time, "{MINUTE}", std::format("{:02}", time.first->tm_min));
-	utility::replace_placeholder(formatted_time, "{SECOND}", std::format("{:02}", time.first->tm_sec));
-	utility::replace_placeholder(formatted_time, "{MILLISECOND}", std::format("{:03}", time.second));
+	try
+	{
+		repeat_arguments.assign(record.arguments);
+		repeat_thread_id.assign(record.thread_id);
+		repeat_thread_name.assign(record.thread_name);
+		repeat_category.assign(record.category);
+		repeat_callsite = record.callsite;
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while storing the message to be collapsed! (error message: \"{}\")", exception.what());
+		repeat_callsite = nullptr;
+	}
+
+	repeat_start_time = current_time;
+	return false;
+}
+
+void sink_base::report_repeats(record& report) noexcept
+{
+	static thread_local std::string storage = "";
+
+	std::size_t message_length = 0UL;
+
+	assert(nullptr != this);
+
+	if (0UL == repeat_count)
+	{
+		return;
+	}
+
+	// The line lives in a thread local buffer, so it is still valid once the repeat mutex is unlocked.
+	try
+	{
+		storage.clear();
+		(void)std::format_to(std::back_inserter(storage), "last message repeated {} times", repeat_count);
+		message_length = storage.length();
+
+		(void)storage.append(repeat_thread_id);
+		(void)storage.append(repeat_thread_name);
+		(void)storage.append(repeat_category);
+	}
+	catch (const std::exception& exception)
+	{
+		DEBUG_PRINT("Caught exception while reporting repeated messages! (error message: \"{}\")", exception.what());
+		count_lost_log(*repeat_callsite, false);
+		repeat_count = 0UL;
+		return;
+	}
+
+	report = { repeat_callsite,
+			   0UL,
+			   0UL,
+			   std::string_view{ storage }.substr(message_length, repeat_thread_id.length()),
+			   std::string_view{ storage }.substr(message_length + repeat_thread_id.length(), repeat_thread_name.length()),
+			   "",
+			   nullptr,
+			   std::string_view{ storage }.substr(0UL, message_length),
+			   false,
+			   std::string_view{ storage }.substr(message_length + repeat_thread_id.length() + repeat_thread_name.length()),
+			   "",
+			   "" };
+
+	repeat_count = 0UL;
+}
+
+void sink_base::flush_repeats(void) noexcept
+{
+	hob::log::record report = {};
 
-	return formatted_time;
+	assert(nullptr != this);
+
+	stop_repeat_watcher();
+	{
+		std::lock_guard<std::mutex> lock = std::lock_guard{ repeat_mutex };
+
+		report_repeats(report);
+		repeat_callsite = nullptr;
+		repeat_count	= 0UL;
+	}
+
+	if (nullptr != report.callsite)
+	{
+		submit(report);
+	}
+}
+
+void sink_base::start_repeat_watcher(void) noexcept
+{
+	std::lock_guard<std::mutex> lock = std::lock_guard{ repeat_mutex };
+
+	assert(nullptr != this);
+
+	if (true == repeat_watcher.joinable())
+	{
+		return;
+	}
+
+	try
+	{
+		is_repeat_watched = true;
+		repeat_watcher	  = std::thread{ &sink_base::watch_repeats, this };
+	}
+	catch (const std::system_error& exception)
+	{
+		// The runs are still reported when a repetition arrives after the timeout.
+		DEBUG_PRINT("Caught std::system_error while starting the thread reporting repeated messages! (error message: \"{}\")", exception.what());
+		is_repeat_watched = false;
+	}
+}
+
+void sink_base::stop_repeat_watcher(void) noexcept
+{
+	std::thread watcher = {};
+
+	assert(nullptr != this);
+
+	{
+		std::lock_guard<std::mutex> lock = std::lock_guard{ repeat_mutex };
+
+		is_repeat_watched = false;
+		watcher			  = std::move(repeat_watcher);
+	}
+	repeat_condition.notify_all();
+
+	if (true == watcher.joinable())
+	{
+		watcher.join();
+	}
+}
+
+void sink_base::watch_repeats(void) noexcept
+{
+	std::unique_lock<std::mutex> lock		  = std::unique_lock{ repeat_mutex };
+	hob::log::record			 report		  = {};
+	std::int64_t				 current_time = 0L;
+	std::int64_t				 expiry_time  = 0L;
+
+	assert(nullptr != this);
+
+	while (true == is_repeat_watched)
+	{
+		if (0UL == repeat_count)
+		{
+			repeat_condition.wait(lock);
+			continue;
+		}
+
+		current_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		expiry_time	 = repeat_start_time + static_cast<std::int64_t>(collapse_timeout.load(std::memory_order_relaxed)) * 1'000'000L;
+		if (current_time < expiry_time)
+		{
+			(void)repeat_condition.wait_until(lock, std::chrono::steady_clock::time_point{ std::chrono::nanoseconds{ expiry_time } });
+			continue;
+		}
+
+		report = {};
+		report_repeats(report);
+		repeat_start_time = current_time;
+
+		if (nullptr != report.callsite)
+		{
+			lock.unlock();
+			submit(report);
+			lock.lock();
+		}
+	}
+}
+
+void sink_base::format_message(std::string& destination, const record& record) const noexcept(false)
+{
+	static thread_local std::string formatted_time	  = "";
+	static thread_local std::string formatted_arguments = "";
+
+	std::string_view message = record.arguments;
+
+	assert(nullptr != this);
+	assert(nullptr != record.callsite);
+
+	formatted_time.clear();
+	if (true == formatter.contains(message_formatter::field::TIME))
+	{
+		format_time(formatted_time, record);
+	}
+
+	if (nullptr != record.decode || 0UL != record.suppressed_count || true == record.is_structured)
+	{
+		formatted_arguments.clear();
+		record.format_message(formatted_arguments);
+		message = formatted_arguments;
+	}
+
+	formatter.format(destination,
+					 message_fields{ formatted_time,
+									 record.callsite->tag,
+									 record.callsite->file_path,
+									 record.callsite->file_name,
+									 record.callsite->function_name,
+									 record.callsite->line,
+									 record.thread_id,
+									 record.thread_name,
+									 message,
+									 record.context });
+	destination.push_back('\n');
+}
+
+void sink_base::stop_async_worker(void) noexcept
+{
+	assert(nullptr != this);
+	async_worker = nullptr;
+}
+
+bool sink_base::is_timestamped(void) const noexcept
+{
+	assert(nullptr != this);
+	return formatter.contains(message_formatter::field::TIME);
+}
+
+std::int64_t sink_base::get_time(const record& record) const noexcept
+{
+	assert(nullptr != this);
+	return clock::to_nanoseconds(timestamp_clock, record.timestamp);
+}
+
+void sink_base::format_time(std::string& destination, const record& record) const noexcept(false)
+{
+	assert(nullptr != this);
+	time_format.format(destination, get_time(record));
 }
 
 } /*< namespace hob::log */
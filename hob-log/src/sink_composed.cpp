@@ -30,35 +30,250 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <algorithm>
+#include <cstdint>
+
 #include "sink_composed.hpp"
 #include "utility.hpp"
 
 /******************************************************************************************************
- * METHOD DEFINITIONS
+ * CONSTANTS
  *****************************************************************************************************/
 
 namespace hob::log
 {
 
+/** ***************************************************************************************************
+ * @brief The membership of the bundled sinks that do not format messages themselves.
+ *****************************************************************************************************/
+static constexpr std::size_t NO_GROUP = SIZE_MAX;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How a message is handed to the sinks of a group, decided when its first sink comes up.
+ *****************************************************************************************************/
+struct HOB_LOG_LOCAL group_dispatch final
+{
+	std::vector<sink_base*>				accepting;		/**< The sinks of the group that accept the message, in order.					*/
+	std::size_t							cursor;			/**< The next accepting sink to be handed the message.							*/
+	bool								is_evaluated;	/**< The filters have been evaluated (otherwise every sink filters by itself).	*/
+	bool								is_shared;		/**< The message has been formatted once for all the accepting sinks.			*/
+	std::string							line;			/**< The line formatted for the group.											*/
+	std::shared_ptr<const std::string>	shared_line;	/**< The line copied once for the sinks in async mode.							*/
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Evaluates the filters of the sinks of a group once and formats the message once if more than
+ * one of them accepts it.
+ * @param group: The sinks that format the messages the same way.
+ * @param dispatch: Where the outcome is stored.
+ * @param record: Everything that has been captured when the message has been logged.
+ * @returns void
+ * @throws N/A.
+ *****************************************************************************************************/
+static void prepare_dispatch(const std::vector<sink_base*>& group, group_dispatch& dispatch, const record& record) noexcept;
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
 sink_composed::sink_composed(const std::string_view name, std::list<std::shared_ptr<sink>>&& sinks) noexcept(false)
 	: sink{ name }
 	, sinks{ std::move(sinks) }
+	, groups{}
+	, memberships{}
+	, is_grouped{ false }
 {
+	assert(false == this->sinks.empty());
+	on_configuration_changed();
+}
+
+void sink_composed::log(const record& record) noexcept
+{
+	static thread_local std::vector<group_dispatch> dispatches		 = {};
+	static thread_local std::size_t					dispatches_count = 0UL;
+
+	const std::size_t						 offset		= dispatches_count;
+	std::vector<std::size_t>::const_iterator membership = memberships.cbegin();
+	sink_base*								 base		= nullptr;
+
 	assert(false == sinks.empty());
+
+	if (true == is_grouped)
+	{
+		try
+		{
+			dispatches.resize(std::max(dispatches.size(), offset + groups.size()));
+		}
+		catch (const std::bad_alloc& exception)
+		{
+			DEBUG_PRINT("Caught std::bad_alloc while preparing the groups! (error message: \"{}\")", exception.what());
+		}
+	}
+
+	if (false == is_grouped || offset + groups.size() > dispatches.size())
+	{
+		for (const std::shared_ptr<sink>& sink : sinks)
+		{
+			sink->log(record);
+		}
+		return;
+	}
+
+	// The nested composed sinks use the dispatches after the ones of this sink.
+	dispatches_count += groups.size();
+
+	// The sinks are handed the message in the order they have been bundled in, the groups being prepared by their first sink.
+	for (const std::shared_ptr<sink>& sink : sinks)
+	{
+		const std::size_t index = *membership++;
+
+		if (NO_GROUP == index)
+		{
+			sink->log(record);
+			continue;
+		}
+
+		group_dispatch& dispatch = dispatches[offset + index];
+		if (sink.get() == groups[index].front())
+		{
+			prepare_dispatch(groups[index], dispatch, record);
+		}
+
+		if (false == dispatch.is_evaluated)
+		{
+			sink->log(record);
+			continue;
+		}
+
+		if (dispatch.accepting.size() == dispatch.cursor || sink.get() != dispatch.accepting[dispatch.cursor])
+		{
+			continue;
+		}
+
+		base = dispatch.accepting[dispatch.cursor++];
+		if (false == dispatch.is_shared)
+		{
+			base->log_accepted(record);
+			continue;
+		}
+
+		base->dispatch(record, dispatch.line, dispatch.shared_line);
+	}
+
+	dispatches_count = offset;
+}
+
+void sink_composed::on_configuration_changed(void) noexcept
+{
+	sink_base* base = nullptr;
+
+	assert(false == sinks.empty());
+
+	is_grouped = false;
+	groups.clear();
+	memberships.clear();
+
+	try
+	{
+		for (const std::shared_ptr<sink>& sink : sinks)
+		{
+			base = dynamic_cast<sink_base*>(sink.get());
+			if (nullptr == base)
+			{
+				memberships.push_back(NO_GROUP);
+				continue;
+			}
+
+			const auto group = std::find_if(groups.begin(),
+											groups.end(),
+											[base](const std::vector<sink_base*>& group) -> bool { return true == base->is_formatted_as(*group.front()); });
+			memberships.push_back(static_cast<std::size_t>(group - groups.begin()));
+			if (groups.end() == group)
+			{
+				(void)groups.emplace_back(1UL, base);
+				continue;
+			}
+
+			group->push_back(base);
+		}
+
+		is_grouped = true;
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while grouping the sinks! (error message: \"{}\")", exception.what());
+	}
 }
 
-void sink_composed::log(const std::uint8_t	   severity_bit,
-						const std::string_view tag,
-						const std::string_view file_path,
-						const std::string_view function_name,
-						const std::int32_t	   line,
-						const std::string_view message) noexcept
+std::uint8_t sink_composed::get_severity_level(void) const noexcept
 {
+	std::uint8_t severity_level = 0U;
+
 	assert(false == sinks.empty());
 
 	for (const std::shared_ptr<sink>& sink : sinks)
 	{
-		sink->log(severity_bit, tag, file_path, function_name, line, message);
+		severity_level |= sink->get_severity_level();
+	}
+
+	return severity_level;
+}
+
+static void prepare_dispatch(const std::vector<sink_base*>& group, group_dispatch& dispatch, const record& record) noexcept
+{
+	dispatch.cursor		  = 0UL;
+	dispatch.is_evaluated = false;
+	dispatch.is_shared	  = false;
+	dispatch.shared_line  = nullptr;
+	dispatch.accepting.clear();
+
+	try
+	{
+		dispatch.accepting.reserve(group.size());
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while preparing a group! (error message: \"{}\")", exception.what());
+		return;
+	}
+
+	// The filters are evaluated once per sink, they might need to format the message.
+	for (sink_base* const sink : group)
+	{
+		if (false == sink->accepts(record))
+		{
+			(void)record.callsite->filtered_count.fetch_add(1UL, std::memory_order_relaxed);
+			continue;
+		}
+
+		dispatch.accepting.push_back(sink);
+	}
+	dispatch.is_evaluated = true;
+
+	// A single sink keeps its own path (in async mode the formatting is deferred to its worker).
+	if (1UL >= dispatch.accepting.size())
+	{
+		return;
+	}
+
+	try
+	{
+		dispatch.line.clear();
+		dispatch.accepting.front()->format_message(dispatch.line, dispatch.accepting.front()->stamp(record));
+		dispatch.is_shared = true;
+	}
+	catch (const std::exception& exception)
+	{
+		// The accepting sinks log the message separately, without being filtered again.
+		DEBUG_PRINT("Caught exception while formatting message for a group! (error message: \"{}\")", exception.what());
 	}
 }
 
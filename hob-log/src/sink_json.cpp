@@ -0,0 +1,371 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file sink_json.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the class defined in sink_json.hpp.
+ * @details The escaping checks a word of eight characters at once with the SIMD within a register
+ * bit tricks: a byte of the word is below 0x20 or equal to '"' or '\' only if its most significant
+ * bit is set after the subtractions below (the borrows can only add false positives above a byte
+ * that already matches, so the answer for the whole word is exact).
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdexcept>
+#include <format>
+#include <iterator>
+#include <variant>
+#include <cstring>
+#include <cmath>
+
+#include "sink_json.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief A word with every byte set to 1.
+ *****************************************************************************************************/
+static constexpr std::uint64_t LOW_BITS = 0x0101'0101'0101'0101UL;
+
+/** ***************************************************************************************************
+ * @brief A word with the most significant bit of every byte set.
+ *****************************************************************************************************/
+static constexpr std::uint64_t HIGH_BITS = 0x8080'8080'8080'8080UL;
+
+/** ***************************************************************************************************
+ * @brief The hexadecimal digits of the escaped control characters.
+ *****************************************************************************************************/
+static constexpr std::string_view HEXADECIMAL_DIGITS = "0123456789abcdef";
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Makes the configuration of the base sink, its format being replaced with one that only holds
+ * the message (the lines are not formatted by it).
+ * @param configuration: The configuration of the JSON sink.
+ * @returns The configuration of the base sink.
+ * @throws N/A.
+ *****************************************************************************************************/
+static sink_base_configuration get_base_configuration(const sink_json_configuration& configuration) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Checks if any of the eight characters of a word needs to be escaped.
+ * @param word: The characters, read as a word.
+ * @returns true - at least one character needs to be escaped.
+ * @returns false - the word can be copied as it is.
+ * @throws N/A.
+ *****************************************************************************************************/
+static bool needs_escaping(std::uint64_t word) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Checks if a character needs to be escaped.
+ * @param character: The character to be checked.
+ * @returns true - the character needs to be escaped.
+ * @returns false - the character can be copied as it is.
+ * @throws N/A.
+ *****************************************************************************************************/
+static bool needs_escaping(char character) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Appends the escape sequence of a character.
+ * @param destination: The string the escape sequence will be appended to.
+ * @param character: The character to be escaped.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+static void escape_character(std::string& destination, char character) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Appends a string member (the key followed by the escaped value), preceded by a comma.
+ * @param destination: The string the member will be appended to.
+ * @param key: The key of the member (it is not escaped).
+ * @param value: The value of the member.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+static void append_member(std::string& destination, std::string_view key, std::string_view value) noexcept(false);
+
+/** ***************************************************************************************************
+ * @brief Appends encoded fields as the members of an object, preceded by a comma.
+ * @param destination: The string the object will be appended to.
+ * @param key: The key of the object (it is not escaped).
+ * @param fields: The encoded fields (@see fields.hpp).
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+static void append_fields(std::string& destination, std::string_view key, std::string_view fields) noexcept(false);
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+sink_json::sink_json(const std::string_view name, const sink_json_configuration& configuration) noexcept(false)
+	: sink_base{ name, get_base_configuration(configuration) }
+	, stream{ nullptr != configuration.stream ? configuration.stream : throw std::invalid_argument{ "Stream is nullptr!" } }
+{
+}
+
+void sink_json::format_message(std::string& destination, const record& record) const noexcept(false)
+{
+	static thread_local std::string buffer = "";
+
+	assert(nullptr != this);
+	assert(nullptr != record.callsite);
+
+	(void)std::format_to(std::back_inserter(destination), "{{\"timestamp\":{}", get_time(record));
+
+	if (false == get_time_format().empty())
+	{
+		buffer.clear();
+		format_time(buffer, record);
+		append_member(destination, "time", buffer);
+	}
+
+	append_member(destination, "tag", record.callsite->tag);
+	append_member(destination, "file", record.callsite->file_path);
+	append_member(destination, "function", record.callsite->function_name);
+	(void)std::format_to(std::back_inserter(destination), ",\"line\":{}", record.callsite->line);
+	append_member(destination, "thread", record.thread_id);
+	append_member(destination, "thread_name", record.thread_name);
+
+	if (true == record.is_structured)
+	{
+		append_member(destination, "message", record.format);
+		append_fields(destination, "fields", record.arguments);
+	}
+	else if (nullptr == record.decode && 0UL == record.suppressed_count)
+	{
+		append_member(destination, "message", record.arguments);
+	}
+	else
+	{
+		buffer.clear();
+		record.format_message(buffer);
+		append_member(destination, "message", buffer);
+	}
+
+	if (false == record.context_fields.empty())
+	{
+		append_fields(destination, "context", record.context_fields);
+	}
+
+	(void)destination.append("}\n");
+}
+
+sink_json::~sink_json(void) noexcept
+{
+	flush_repeats();
+	stop_async_worker();
+}
+
+bool sink_json::is_timestamped(void) const noexcept
+{
+	assert(nullptr != this);
+	return true;
+}
+
+bool sink_json::log(const std::uint8_t severity_bit, const std::string_view message) noexcept
+{
+	assert(nullptr != this);
+
+	if (message.length() != std::fwrite(message.data(), sizeof(char), message.length(), stream))
+	{
+		DEBUG_PRINT("Failed to write the JSON line!");
+		return false;
+	}
+
+	return true;
+}
+
+std::size_t sink_json::log_batch(const std::span<const sink_line> lines) noexcept
+{
+	assert(nullptr != this);
+	return write_lines(stream, lines);
+}
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+void json::escape(std::string& destination, const std::string_view string) noexcept(false)
+{
+	const char*		  current = string.data();
+	const char* const end	  = current + string.length();
+	const char*		  run	  = current;
+	std::uint64_t	  word	  = 0UL;
+
+	while (end != current)
+	{
+		if (static_cast<std::ptrdiff_t>(sizeof(word)) <= end - current)
+		{
+			(void)std::memcpy(&word, current, sizeof(word));
+			if (false == needs_escaping(word))
+			{
+				current += sizeof(word);
+				continue;
+			}
+		}
+
+		if (true == needs_escaping(*current))
+		{
+			(void)destination.append(run, current);
+			escape_character(destination, *current);
+			run = current + 1L;
+		}
+
+		++current;
+	}
+
+	(void)destination.append(run, end);
+}
+
+static sink_base_configuration get_base_configuration(const sink_json_configuration& configuration) noexcept
+{
+	sink_base_configuration base_configuration = configuration.base;
+
+	base_configuration.format = "{MESSAGE}";
+	return base_configuration;
+}
+
+static bool needs_escaping(const std::uint64_t word) noexcept
+{
+	const std::uint64_t quotes		= word ^ (LOW_BITS * static_cast<std::uint64_t>('"'));
+	const std::uint64_t backslashes = word ^ (LOW_BITS * static_cast<std::uint64_t>('\\'));
+
+	return 0UL != (((word - LOW_BITS * 0x20UL) | (quotes - LOW_BITS) | (backslashes - LOW_BITS)) & ~word & HIGH_BITS);
+}
+
+static bool needs_escaping(const char character) noexcept
+{
+	return 0x20U > static_cast<unsigned char>(character) || '"' == character || '\\' == character;
+}
+
+static void escape_character(std::string& destination, const char character) noexcept(false)
+{
+	switch (character)
+	{
+		case '"':
+		{
+			(void)destination.append("\\\"");
+			break;
+		}
+		case '\\':
+		{
+			(void)destination.append("\\\\");
+			break;
+		}
+		case '\n':
+		{
+			(void)destination.append("\\n");
+			break;
+		}
+		case '\r':
+		{
+			(void)destination.append("\\r");
+			break;
+		}
+		case '\t':
+		{
+			(void)destination.append("\\t");
+			break;
+		}
+		default:
+		{
+			(void)destination.append("\\u00");
+			destination.push_back(HEXADECIMAL_DIGITS[static_cast<unsigned char>(character) >> 4U]);
+			destination.push_back(HEXADECIMAL_DIGITS[static_cast<unsigned char>(character) & 0x0FU]);
+			break;
+		}
+	}
+}
+
+static void append_member(std::string& destination, const std::string_view key, const std::string_view value) noexcept(false)
+{
+	(void)destination.append(",\"");
+	(void)destination.append(key);
+	(void)destination.append("\":\"");
+	json::escape(destination, value);
+	destination.push_back('"');
+}
+
+static void append_fields(std::string& destination, const std::string_view key, std::string_view fields) noexcept(false)
+{
+	bool is_first = true;
+
+	(void)destination.append(",\"");
+	(void)destination.append(key);
+	(void)destination.append("\":{");
+	while (false == fields.empty())
+	{
+		const details::field field = details::deserialize_field(fields);
+
+		(void)destination.append(true == is_first ? "\"" : ",\"");
+		json::escape(destination, field.key);
+		(void)destination.append("\":");
+		is_first = false;
+
+		std::visit(
+			[&destination](const auto& value) -> void
+			{
+				using type = std::decay_t<decltype(value)>;
+
+				if constexpr (true == std::is_same_v<std::string_view, type>)
+				{
+					destination.push_back('"');
+					json::escape(destination, value);
+					destination.push_back('"');
+				}
+				else if constexpr (true == std::is_same_v<double, type>)
+				{
+					// JSON has no representation for infinities and NaN.
+					if (false == std::isfinite(value))
+					{
+						(void)destination.append("null");
+						return;
+					}
+
+					(void)std::format_to(std::back_inserter(destination), "{}", value);
+				}
+				else
+				{
+					(void)std::format_to(std::back_inserter(destination), "{}", value);
+				}
+			},
+			field.value);
+	}
+
+	destination.push_back('}');
+}
+
+} /*< namespace hob::log */
@@ -30,9 +30,15 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <bit>
+
 #include "sink_manager.hpp"
 #include "sink_terminal.hpp"
+#include "sink_json.hpp"
 #include "sink_composed.hpp"
+#include "category_registry.hpp"
+#include "utility.hpp"
+#include "details/internal.hpp"
 
 /******************************************************************************************************
  * CONSTANTS
@@ -65,6 +71,17 @@ sink_manager::sink_manager(const std::string_view configuration_file_path) noexc
 
 sink_manager::~sink_manager(void) noexcept
 {
+	details::severity_mask = 0U;
+
+	try
+	{
+		category_registry::set_sinks({});
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while clearing the routing tables! (error message: \"{}\")", exception.what());
+	}
+
 	if (true == configuration_file_path.empty())
 	{
 		return;
@@ -79,6 +96,16 @@ void sink_manager::add_sink(const std::string_view sink_name, const sink_termina
 
 	throw_if_sink_name_invalid(sink_name);
 	(void)sinks.emplace_back(std::make_shared<sink_terminal>(sink_name, configuration));
+	on_configuration_changed();
+}
+
+void sink_manager::add_sink(const std::string_view sink_name, const sink_json_configuration& configuration) noexcept(false)
+{
+	assert(nullptr != this);
+
+	throw_if_sink_name_invalid(sink_name);
+	(void)sinks.emplace_back(std::make_shared<sink_json>(sink_name, configuration));
+	on_configuration_changed();
 }
 
 void sink_manager::add_sink(const std::string_view sink_name, const std::list<std::string>& sink_names) noexcept(false)
@@ -94,6 +121,7 @@ void sink_manager::add_sink(const std::string_view sink_name, const std::list<st
 	}
 
 	(void)this->sinks.emplace_back(std::make_shared<sink_composed>(sink_name, std::move(sinks)));
+	on_configuration_changed();
 }
 
 void sink_manager::remove_sink(const std::string_view sink_name) noexcept
@@ -101,6 +129,54 @@ void sink_manager::remove_sink(const std::string_view sink_name) noexcept
 	assert(nullptr != this);
 	(void)sinks.erase(std::remove_if(sinks.begin(), sinks.end(), [sink_name](const std::shared_ptr<sink>& sink) { return sink_name == sink->get_name(); }),
 					  sinks.end());
+	on_configuration_changed();
+}
+
+void sink_manager::on_configuration_changed(void) const noexcept
+{
+	std::uint8_t							   severity_mask = 0U;
+	std::vector<category_registry::sink_entry> entries		 = {};
+
+	assert(nullptr != this);
+
+	for (const std::shared_ptr<sink>& sink : sinks)
+	{
+		sink->on_configuration_changed();
+		severity_mask |= sink->get_severity_level();
+	}
+
+	details::severity_mask = severity_mask;
+
+	try
+	{
+		entries.reserve(sinks.size());
+		for (const std::shared_ptr<sink>& sink : sinks)
+		{
+			(void)entries.emplace_back(std::string{ sink->get_name() }, sink->get_severity_level());
+		}
+
+		category_registry::set_sinks(std::move(entries));
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while rebuilding the routing tables! (error message: \"{}\")", exception.what());
+	}
+}
+
+void sink_manager::log(std::uint64_t sinks, const record& record) noexcept
+{
+	std::size_t index = 0UL;
+
+	assert(nullptr != this);
+
+	for (; 0UL != sinks; sinks &= sinks - 1UL)
+	{
+		index = static_cast<std::size_t>(std::countr_zero(sinks));
+		if (index < this->sinks.size())
+		{
+			this->sinks[index]->log(record);
+		}
+	}
 }
 
 bool sink_manager::is_sink_valid(const std::string_view sink_name) const noexcept
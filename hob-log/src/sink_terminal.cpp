@@ -30,17 +30,43 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <cstdio>
+#include <string>
+#include <vector>
 #include <stdexcept>
 
 #include "sink_terminal.hpp"
 #include "utility.hpp"
 
+namespace hob::log
+{
+
 /******************************************************************************************************
- * METHOD DEFINITIONS
+ * CONSTANTS
  *****************************************************************************************************/
 
-namespace hob::log
-{
+/** ***************************************************************************************************
+ * @brief The escape sequence restoring the default color of the terminal.
+ *****************************************************************************************************/
+static constexpr std::string_view DEFAULT_COLOR = "\033[1;0m";
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gets the escape sequence that changes the color of the terminal for a severity level (null
+ * terminated).
+ * @param severity_bit: Bit indicating the type of message that is being logged (see
+ * hob::log::severity_level).
+ * @returns The escape sequence (the default color for unknown severities).
+ * @throws N/A.
+ *****************************************************************************************************/
+[[nodiscard]] static std::string_view get_color_code(std::uint8_t severity_bit) noexcept;
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
 
 sink_terminal::sink_terminal(const std::string_view name, const sink_terminal_configuration& configuration) noexcept(false)
 	: sink_base{ name, configuration.base }
@@ -51,6 +77,12 @@ sink_terminal::sink_terminal(const std::string_view name, const sink_terminal_co
 	set_color(configuration.color);
 }
 
+sink_terminal::~sink_terminal(void) noexcept
+{
+	flush_repeats();
+	stop_async_worker();
+}
+
 void sink_terminal::set_stream(FILE* const stream) noexcept(false)
 {
 	assert(nullptr != this);
@@ -83,90 +115,119 @@ bool sink_terminal::get_color(void) const noexcept
 
 bool sink_terminal::log(const std::uint8_t severity_bit, const std::string_view message) noexcept
 {
-	color color = { color_enabled, severity_bit };
+	color color = { stream, color_enabled, severity_bit };
 
 	assert(nullptr != this);
-	try
-	{
-		std::print(stream, "{}", message);
-		return true;
-	}
-	catch (const std::exception& exception)
+
+	if (message.length() != std::fwrite(message.data(), sizeof(char), message.length(), stream))
 	{
-		DEBUG_PRINT("Caught std::exception while printing to the terminal! (error message: \"{}\")", exception.what());
+		DEBUG_PRINT("Failed to print to the terminal!");
 		return false;
 	}
+
+	return true;
 }
 
-color::color(const bool color_enabled, const std::uint8_t severity_bit) noexcept
-	: color_enabled{ color_enabled }
+std::size_t sink_terminal::log_batch(const std::span<const sink_line> lines) noexcept
 {
+	static thread_local std::string			   colored_messages = "";
+	static thread_local std::vector<sink_line> colored_lines	= {};
+
+	std::size_t message_begin = 0UL;
+
+	assert(nullptr != this);
+
 	if (false == color_enabled)
 	{
-		return;
+		return write_lines(stream, lines);
 	}
 
 	try
 	{
-		switch (severity_bit)
+		colored_messages.clear();
+		colored_lines.clear();
+		colored_lines.reserve(lines.size());
+
+		for (const sink_line& line : lines)
 		{
-			case severity_level::FATAL:
-			{
-				std::print("\033[1;31m");
-				break;
-			}
-			case severity_level::ERROR:
-			{
-				std::print("\033[0;91m");
-				break;
-			}
-			case severity_level::WARN:
-			{
-				std::print("\033[0;93m");
-				break;
-			}
-			case severity_level::INFO:
-			{
-				std::print("\033[1;32m");
-				break;
-			}
-			case severity_level::DEBUG:
-			{
-				std::print("\033[1;36m");
-				break;
-			}
-			case severity_level::TRACE:
-			{
-				std::print("\033[0;90m");
-				break;
-			}
-			default:
-			{
-				std::print("\033[1;0m");
-				break;
-			}
+			(void)colored_messages.append(get_color_code(line.severity_bit)).append(line.message).append(DEFAULT_COLOR);
 		}
 	}
-	catch (const std::exception& exception)
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while coloring batch of messages! (error message: \"{}\")", exception.what());
+		return sink_base::log_batch(lines);
+	}
+
+	for (const sink_line& line : lines)
 	{
-		DEBUG_PRINT("Caught std::exception while changing the terminal color! (error message: \"{}\")", exception.what());
+		const std::size_t length = get_color_code(line.severity_bit).length() + line.message.length() + DEFAULT_COLOR.length();
+
+		colored_lines.push_back({ line.severity_bit, std::string_view{ colored_messages }.substr(message_begin, length) });
+		message_begin += length;
 	}
+
+	return write_lines(stream, colored_lines);
 }
 
-color::~color(void) noexcept
+color::color(FILE* const stream, const bool color_enabled, const std::uint8_t severity_bit) noexcept
+	: stream{ stream }
+	, color_enabled{ color_enabled }
 {
 	if (false == color_enabled)
 	{
 		return;
 	}
 
-	try
+	(void)std::fputs(get_color_code(severity_bit).data(), stream);
+}
+
+color::~color(void) noexcept
+{
+	if (false == color_enabled)
 	{
-		std::print("\033[1;0m");
+		return;
 	}
-	catch (const std::exception& exception)
+
+	(void)std::fputs(DEFAULT_COLOR.data(), stream);
+}
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+static std::string_view get_color_code(const std::uint8_t severity_bit) noexcept
+{
+	switch (severity_bit)
 	{
-		DEBUG_PRINT("Caught std::exception while restoring the terminal color! (error message: \"{}\")", exception.what());
+		case severity_level::FATAL:
+		{
+			return "\033[1;31m";
+		}
+		case severity_level::ERROR:
+		{
+			return "\033[0;91m";
+		}
+		case severity_level::WARN:
+		{
+			return "\033[0;93m";
+		}
+		case severity_level::INFO:
+		{
+			return "\033[1;32m";
+		}
+		case severity_level::DEBUG:
+		{
+			return "\033[1;36m";
+		}
+		case severity_level::TRACE:
+		{
+			return "\033[0;90m";
+		}
+		default:
+		{
+			return DEFAULT_COLOR;
+		}
 	}
 }
 
@@ -0,0 +1,121 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file thread_info.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the functions defined in thread_info.hpp.
+ * @todo N/A.
+ * @bug pthread_setname_np() is being used, which enforces the platform to be POSIX.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <array>
+#include <thread>
+#include <format>
+#include <pthread.h>
+
+#include "thread_info.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The maximum length of a name accepted by the kernel (without the NUL terminator).
+ *****************************************************************************************************/
+static constexpr std::size_t KERNEL_THREAD_NAME_LENGTH = 15UL;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The rendered identifier of the thread.
+ *****************************************************************************************************/
+static thread_local std::array<char, 32UL> thread_id = {};
+
+/** ***************************************************************************************************
+ * @brief The length of the rendered identifier of the thread (0 if it has not been rendered yet).
+ *****************************************************************************************************/
+static thread_local std::size_t thread_id_length = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The name of the thread given by the user (empty if it has not been set).
+ *****************************************************************************************************/
+static thread_local std::string thread_name = "";
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+std::string_view thread_info::get_thread_id(void) noexcept
+{
+	if (0UL == thread_id_length)
+	{
+		try
+		{
+			thread_id_length = static_cast<std::size_t>(
+				std::format_to_n(thread_id.data(), static_cast<std::ptrdiff_t>(thread_id.size()), "{}", std::this_thread::get_id()).out - thread_id.data());
+		}
+		catch (const std::exception& exception)
+		{
+			DEBUG_PRINT("Caught std::exception while rendering the thread identifier! (error message: \"{}\")", exception.what());
+		}
+	}
+
+	return { thread_id.data(), thread_id_length };
+}
+
+std::string_view thread_info::get_thread_name(void) noexcept
+{
+	return true == thread_name.empty() ? get_thread_id() : std::string_view{ thread_name };
+}
+
+void thread_info::set_thread_name(const std::string_view name) noexcept(false)
+{
+	std::array<char, KERNEL_THREAD_NAME_LENGTH + 1UL> kernel_name = {};
+	std::int32_t									  error		  = 0;
+
+	thread_name = name;
+
+	(void)name.copy(kernel_name.data(), KERNEL_THREAD_NAME_LENGTH);
+
+#ifdef __APPLE__
+	error = pthread_setname_np(kernel_name.data());
+#else
+	error = pthread_setname_np(pthread_self(), kernel_name.data());
+#endif /*< __APPLE__ */
+
+	if (0 != error)
+	{
+		DEBUG_PRINT("Failed to give the thread name to the kernel! (error code: {})", error);
+	}
+}
+
+} /*< namespace hob::log */
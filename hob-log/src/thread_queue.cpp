@@ -0,0 +1,215 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+
+/** ***************************************************************************************************
+ * @file thread_queue.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the class defined in thread_queue.hpp.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <bit>
+#include <algorithm>
+
+#include "thread_queue.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+thread_queue::thread_queue(const std::size_t capacity) noexcept(false)
+	: slots{ std::make_unique<slot[]>(std::bit_ceil(std::max(capacity, 2UL))) }
+	, mask{ std::bit_ceil(std::max(capacity, 2UL)) - 1UL }
+	, end_position{ 0UL }
+	, cached_begin_position{ 0UL }
+	, begin_position{ 0UL }
+	, cached_end_position{ 0UL }
+	, is_supplier_gone{ false }
+	, is_consumer_gone{ false }
+{
+}
+
+bool thread_queue::is_empty(void) const noexcept
+{
+	assert(nullptr != this);
+	return begin_position.load(std::memory_order_relaxed) == end_position.load(std::memory_order_acquire);
+}
+
+bool thread_queue::emplace(const record& record, const std::uint64_t key) noexcept
+{
+	const std::uint64_t position = end_position.load(std::memory_order_relaxed);
+
+	assert(nullptr != this);
+
+	if (mask < position - cached_begin_position)
+	{
+		cached_begin_position = begin_position.load(std::memory_order_acquire);
+		if (mask < position - cached_begin_position)
+		{
+			return false;
+		}
+	}
+
+	try
+	{
+		slots[position & mask].record.assign(record);
+	}
+	catch (const std::bad_alloc& exception)
+	{
+		DEBUG_PRINT("Caught std::bad_alloc while emplacing message into thread queue! (error message: \"{}\")", exception.what());
+		return false;
+	}
+
+	slots[position & mask].key = key;
+	end_position.store(position + 1UL, std::memory_order_release);
+
+	return true;
+}
+
+bool thread_queue::emplace(const details::callsite* const callsite, const std::shared_ptr<const std::string>& line, const std::uint64_t key) noexcept
+{
+	const std::uint64_t position = end_position.load(std::memory_order_relaxed);
+
+	assert(nullptr != this);
+
+	if (mask < position - cached_begin_position)
+	{
+		cached_begin_position = begin_position.load(std::memory_order_acquire);
+		if (mask < position - cached_begin_position)
+		{
+			return false;
+		}
+	}
+
+	slots[position & mask].record.assign(callsite, line);
+	slots[position & mask].key = key;
+	end_position.store(position + 1UL, std::memory_order_release);
+
+	return true;
+}
+
+const stored_record* thread_queue::front(void) noexcept
+{
+	const std::uint64_t position = begin_position.load(std::memory_order_relaxed);
+
+	assert(nullptr != this);
+
+	if (position == cached_end_position)
+	{
+		cached_end_position = end_position.load(std::memory_order_acquire);
+		if (position == cached_end_position)
+		{
+			return nullptr;
+		}
+	}
+
+	return &slots[position & mask].record;
+}
+
+std::uint64_t thread_queue::get_front_key(void) const noexcept
+{
+	assert(nullptr != this);
+	assert(begin_position.load(std::memory_order_relaxed) != cached_end_position);
+
+	return slots[begin_position.load(std::memory_order_relaxed) & mask].key;
+}
+
+void thread_queue::pop(void) noexcept
+{
+	const std::uint64_t position = begin_position.load(std::memory_order_relaxed);
+
+	assert(nullptr != this);
+	assert(position != cached_end_position);
+
+	slots[position & mask].record.release();
+	begin_position.store(position + 1UL, std::memory_order_release);
+}
+
+std::size_t thread_queue::front(const std::span<const stored_record*> records, const std::uint64_t last_key) noexcept
+{
+	const std::uint64_t position = begin_position.load(std::memory_order_relaxed);
+	std::size_t			count	 = 0UL;
+
+	assert(nullptr != this);
+
+	if (records.size() > cached_end_position - position)
+	{
+		cached_end_position = end_position.load(std::memory_order_acquire);
+	}
+
+	while (count < records.size() && position + count != cached_end_position && last_key >= slots[(position + count) & mask].key)
+	{
+		records[count] = &slots[(position + count) & mask].record;
+		++count;
+	}
+
+	return count;
+}
+
+void thread_queue::pop(const std::size_t count) noexcept
+{
+	const std::uint64_t position = begin_position.load(std::memory_order_relaxed);
+
+	assert(nullptr != this);
+	assert(count <= cached_end_position - position);
+
+	for (std::uint64_t index = position; index < position + count; ++index)
+	{
+		slots[index & mask].record.release();
+	}
+
+	begin_position.store(position + count, std::memory_order_release);
+}
+
+void thread_queue::close(void) noexcept
+{
+	assert(nullptr != this);
+	is_supplier_gone.store(true, std::memory_order_release);
+}
+
+bool thread_queue::is_closed(void) const noexcept
+{
+	assert(nullptr != this);
+	return is_supplier_gone.load(std::memory_order_acquire);
+}
+
+void thread_queue::abandon(void) noexcept
+{
+	assert(nullptr != this);
+	is_consumer_gone.store(true, std::memory_order_release);
+}
+
+bool thread_queue::is_abandoned(void) const noexcept
+{
+	assert(nullptr != this);
+	return is_consumer_gone.load(std::memory_order_acquire);
+}
+
+} /*< namespace hob::log */
@@ -0,0 +1,512 @@
+/******************************************************************************************************
+ * Copyright (C) 2024 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file time_formatter.cpp
+ * @author Gaina Stefan
+ * @date 17.10.2026
+ * @brief This file implements the class defined in time_formatter.hpp.
+ * @todo N/A.
+ * @bug localtime_r() and tm_gmtoff are being used, which enforces the platform to be POSIX.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <ctime>
+
+#include "time_formatter.hpp"
+#include "utility.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+namespace hob::log
+{
+
+/** ***************************************************************************************************
+ * @brief The placeholders that are recognized inside a time format and their operations.
+ *****************************************************************************************************/
+static constexpr std::array<std::pair<std::string_view, time_formatter::field>, 18UL> TIME_PLACEHOLDERS = {
+	std::pair{ "{YEAR}", time_formatter::field::YEAR },
+	std::pair{ "{MONTH:numeric}", time_formatter::field::MONTH_NUMERIC },
+	std::pair{ "{MONTH:long}", time_formatter::field::MONTH_LONG },
+	std::pair{ "{MONTH:short}", time_formatter::field::MONTH_SHORT },
+	std::pair{ "{DAY_YEAR}", time_formatter::field::DAY_YEAR },
+	std::pair{ "{DAY_MONTH}", time_formatter::field::DAY_MONTH },
+	std::pair{ "{DAY_WEEK:numeric}", time_formatter::field::DAY_WEEK_NUMERIC },
+	std::pair{ "{DAY_WEEK:long}", time_formatter::field::DAY_WEEK_LONG },
+	std::pair{ "{DAY_WEEK:short}", time_formatter::field::DAY_WEEK_SHORT },
+	std::pair{ "{HOUR:24}", time_formatter::field::HOUR_24 },
+	std::pair{ "{HOUR:12}", time_formatter::field::HOUR_12 },
+	std::pair{ "{MERIDIEM}", time_formatter::field::MERIDIEM },
+	std::pair{ "{MINUTE}", time_formatter::field::MINUTE },
+	std::pair{ "{SECOND}", time_formatter::field::SECOND },
+	std::pair{ "{MILLISECOND}", time_formatter::field::MILLISECOND },
+	std::pair{ "{MICROSECOND}", time_formatter::field::MICROSECOND },
+	std::pair{ "{NANOSECOND}", time_formatter::field::NANOSECOND },
+	std::pair{ "{EPOCH_NS}", time_formatter::field::EPOCH_NS }
+};
+
+/** ***************************************************************************************************
+ * @brief The full names of the months.
+ *****************************************************************************************************/
+static constexpr std::array<std::string_view, 12UL> MONTHS_LONG = {
+	"January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"
+};
+
+/** ***************************************************************************************************
+ * @brief The abbreviated names of the months.
+ *****************************************************************************************************/
+static constexpr std::array<std::string_view, 12UL> MONTHS_SHORT = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+/** ***************************************************************************************************
+ * @brief The full names of the days of the week.
+ *****************************************************************************************************/
+static constexpr std::array<std::string_view, 7UL> DAYS_LONG = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
+
+/** ***************************************************************************************************
+ * @brief The abbreviated names of the days of the week.
+ *****************************************************************************************************/
+static constexpr std::array<std::string_view, 7UL> DAYS_SHORT = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+
+/** ***************************************************************************************************
+ * @brief The number of days before the start of every month in a non-leap year.
+ *****************************************************************************************************/
+static constexpr std::array<std::int32_t, 12UL> DAYS_BEFORE_MONTH = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+/** ***************************************************************************************************
+ * @brief How many rendered formats every thread keeps. They are searched by format identifier, a
+ * format that is not cached replacing the least recently used one. A thread alternating between more
+ * formats than this renders them again on every call.
+ *****************************************************************************************************/
+static constexpr std::size_t CACHE_ENTRIES = 8UL;
+
+/** ***************************************************************************************************
+ * @brief The interval in which the UTC offset is assumed not to change (time zones offsets and their
+ * transitions are multiples of 15 minutes).
+ *****************************************************************************************************/
+static constexpr std::int64_t UTC_OFFSET_PERIOD = 15L * 60L;
+
+/** ***************************************************************************************************
+ * @brief How many nanoseconds are in a second.
+ *****************************************************************************************************/
+static constexpr std::int64_t NANOSECONDS_PER_SECOND = 1'000'000'000L;
+
+/** ***************************************************************************************************
+ * @brief How many seconds are in a day.
+ *****************************************************************************************************/
+static constexpr std::int64_t SECONDS_PER_DAY = 86'400L;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Source of the process-wide unique identifiers of the compiled formats (0 is never used so
+ * zero initialized cache entries are always invalid).
+ *****************************************************************************************************/
+static std::atomic<std::uint64_t> next_identifier = 1UL;
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Broken down local time (same meaning of the fields as std::tm).
+ *****************************************************************************************************/
+struct calendar final
+{
+	std::int64_t year;		 /**< The year (e.g. 2024).		 */
+	std::int32_t month;		 /**< The month, [0, 11].			 */
+	std::int32_t day_month;	 /**< The day of the month, [1, 31]. */
+	std::int32_t day_year;	 /**< The day of the year, [0, 365]. */
+	std::int32_t day_week;	 /**< The day of the week, [0, 6].	 */
+	std::int32_t hour;		 /**< The hour, [0, 23].			 */
+	std::int32_t minute;	 /**< The minute, [0, 59].			 */
+	std::int32_t second;	 /**< The second, [0, 59].			 */
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Divides rounding towards negative infinity.
+ * @param dividend: The number to be divided.
+ * @param divisor: The number to divide by (strictly positive).
+ * @returns The quotient rounded down.
+ * @throws N/A.
+ *****************************************************************************************************/
+static constexpr std::int64_t floor_divide(std::int64_t dividend, std::int64_t divisor) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Gets the offset of the local time zone from UTC, refreshing it only when the time leaves the
+ * period it has been computed for. It is thread-safe.
+ * @param second: The second since the epoch for which the offset is requested.
+ * @returns The offset in seconds (0 if it could not be determined).
+ * @throws N/A.
+ *****************************************************************************************************/
+static std::int64_t get_utc_offset(std::int64_t second) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Breaks down a second since the epoch into local calendar fields. It is thread-safe.
+ * @param second: The second since the epoch.
+ * @returns The local calendar fields.
+ * @throws N/A.
+ *****************************************************************************************************/
+static calendar to_calendar(std::int64_t second) noexcept;
+
+/** ***************************************************************************************************
+ * @brief Appends the decimal representation of a number padded with zeros to the destination. It is
+ * thread-safe.
+ * @param destination: The string the number will be appended to.
+ * @param value: The number to be appended.
+ * @param width: The minimum number of digits.
+ * @returns void
+ * @throws std::bad_alloc: If the destination needs to grow and the memory reallocation fails.
+ *****************************************************************************************************/
+static void append_integer(std::string& destination, std::int64_t value, std::size_t width) noexcept(false);
+
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+time_formatter::time_formatter(void) noexcept
+	: source{}
+	, tokens{}
+	, identifier{ 0UL }
+{
+}
+
+void time_formatter::compile(const std::string_view format) noexcept(false)
+{
+	std::vector<token> tokens		 = {};
+	std::size_t		   literal_begin = 0UL;
+	std::size_t		   position		 = 0UL;
+
+	assert(nullptr != this);
+
+	while (std::string_view::npos != (position = format.find('{', position)))
+	{
+		const auto placeholder = std::find_if(TIME_PLACEHOLDERS.begin(),
+											  TIME_PLACEHOLDERS.end(),
+											  [format, position](const std::pair<std::string_view, field>& placeholder)
+											  { return format.substr(position).starts_with(placeholder.first); });
+		if (TIME_PLACEHOLDERS.end() == placeholder)
+		{
+			++position;
+			continue;
+		}
+
+		if (literal_begin < position)
+		{
+			tokens.push_back(token{ field::LITERAL, literal_begin, position - literal_begin });
+		}
+
+		tokens.push_back(token{ placeholder->second, 0UL, 0UL });
+
+		position += placeholder->first.length();
+		literal_begin = position;
+	}
+
+	if (literal_begin < format.length())
+	{
+		tokens.push_back(token{ field::LITERAL, literal_begin, format.length() - literal_begin });
+	}
+
+	source		 = format;
+	this->tokens = std::move(tokens);
+	identifier	 = next_identifier.fetch_add(1UL, std::memory_order_relaxed);
+}
+
+std::string_view time_formatter::get_format(void) const noexcept
+{
+	assert(nullptr != this);
+	return source;
+}
+
+void time_formatter::format(std::string& destination, const std::int64_t timestamp) const noexcept(false)
+{
+	static thread_local std::array<cache, CACHE_ENTRIES> caches		= {};
+	static thread_local std::uint64_t					 uses_count	= 0UL;
+
+	const std::int64_t second	 = floor_divide(timestamp, NANOSECONDS_PER_SECOND);
+	const std::int64_t subsecond = timestamp - second * NANOSECONDS_PER_SECOND;
+	cache*			   entry	 = &caches.front();
+	std::size_t		   position	 = 0UL;
+
+	assert(nullptr != this);
+
+	if (true == tokens.empty())
+	{
+		return;
+	}
+
+	// If the format is not cached the least recently used entry is replaced.
+	for (cache& candidate : caches)
+	{
+		if (identifier == candidate.identifier)
+		{
+			entry = &candidate;
+			break;
+		}
+
+		if (candidate.last_use < entry->last_use)
+		{
+			entry = &candidate;
+		}
+	}
+
+	entry->last_use = ++uses_count;
+	if (identifier != entry->identifier || second != entry->second)
+	{
+		render(*entry, second);
+	}
+
+	for (const std::pair<std::size_t, field>& patch : entry->patches)
+	{
+		(void)destination.append(entry->rendered, position, patch.first - position);
+		position = patch.first;
+
+		switch (patch.second)
+		{
+			case field::MILLISECOND:
+			{
+				append_integer(destination, subsecond / 1'000'000L, 3UL);
+				break;
+			}
+			case field::MICROSECOND:
+			{
+				append_integer(destination, subsecond / 1'000L, 6UL);
+				break;
+			}
+			case field::NANOSECOND:
+			{
+				append_integer(destination, subsecond, 9UL);
+				break;
+			}
+			case field::EPOCH_NS:
+			{
+				append_integer(destination, timestamp, 1UL);
+				break;
+			}
+			default:
+			{
+				assert(false);
+				break;
+			}
+		}
+	}
+
+	(void)destination.append(entry->rendered, position);
+}
+
+void time_formatter::render(cache& entry, const std::int64_t second) const noexcept(false)
+{
+	const calendar time = to_calendar(second);
+
+	assert(nullptr != this);
+
+	entry.identifier = 0UL;
+	entry.rendered.clear();
+	entry.patches.clear();
+
+	for (const token& token : tokens)
+	{
+		switch (token.type)
+		{
+			case field::LITERAL:
+			{
+				(void)entry.rendered.append(source, token.offset, token.length);
+				break;
+			}
+			case field::YEAR:
+			{
+				append_integer(entry.rendered, time.year, 4UL);
+				break;
+			}
+			case field::MONTH_NUMERIC:
+			{
+				append_integer(entry.rendered, time.month + 1, 2UL);
+				break;
+			}
+			case field::MONTH_LONG:
+			{
+				(void)entry.rendered.append(MONTHS_LONG[time.month]);
+				break;
+			}
+			case field::MONTH_SHORT:
+			{
+				(void)entry.rendered.append(MONTHS_SHORT[time.month]);
+				break;
+			}
+			case field::DAY_YEAR:
+			{
+				append_integer(entry.rendered, time.day_year + 1, 3UL);
+				break;
+			}
+			case field::DAY_MONTH:
+			{
+				append_integer(entry.rendered, time.day_month, 2UL);
+				break;
+			}
+			case field::DAY_WEEK_NUMERIC:
+			{
+				append_integer(entry.rendered, time.day_week, 1UL);
+				break;
+			}
+			case field::DAY_WEEK_LONG:
+			{
+				(void)entry.rendered.append(DAYS_LONG[time.day_week]);
+				break;
+			}
+			case field::DAY_WEEK_SHORT:
+			{
+				(void)entry.rendered.append(DAYS_SHORT[time.day_week]);
+				break;
+			}
+			case field::HOUR_24:
+			{
+				append_integer(entry.rendered, time.hour, 2UL);
+				break;
+			}
+			case field::HOUR_12:
+			{
+				append_integer(entry.rendered, 0 == time.hour % 12 ? 12 : time.hour % 12, 2UL);
+				break;
+			}
+			case field::MERIDIEM:
+			{
+				(void)entry.rendered.append(12 > time.hour ? "AM" : "PM");
+				break;
+			}
+			case field::MINUTE:
+			{
+				append_integer(entry.rendered, time.minute, 2UL);
+				break;
+			}
+			case field::SECOND:
+			{
+				append_integer(entry.rendered, time.second, 2UL);
+				break;
+			}
+			case field::MILLISECOND:
+			case field::MICROSECOND:
+			case field::NANOSECOND:
+			case field::EPOCH_NS:
+			{
+				entry.patches.emplace_back(entry.rendered.length(), token.type);
+				break;
+			}
+		}
+	}
+
+	entry.identifier = identifier;
+	entry.second	 = second;
+}
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+static constexpr std::int64_t floor_divide(const std::int64_t dividend, const std::int64_t divisor) noexcept
+{
+	assert(0L < divisor);
+	return 0L <= dividend ? dividend / divisor : -((-dividend - 1L) / divisor) - 1L;
+}
+
+static std::int64_t get_utc_offset(const std::int64_t second) noexcept
+{
+	static thread_local std::int64_t period_begin = 0L;
+	static thread_local std::int64_t period_end	  = 0L;
+	static thread_local std::int64_t offset		  = 0L;
+
+	std::tm		local_time = {};
+	std::time_t time	   = static_cast<std::time_t>(second);
+
+	if (period_begin <= second && period_end > second)
+	{
+		return offset;
+	}
+
+	offset		 = nullptr != localtime_r(&time, &local_time) ? local_time.tm_gmtoff : 0L;
+	period_begin = floor_divide(second, UTC_OFFSET_PERIOD) * UTC_OFFSET_PERIOD;
+	period_end	 = period_begin + UTC_OFFSET_PERIOD;
+
+	return offset;
+}
+
+static calendar to_calendar(const std::int64_t second) noexcept
+{
+	const std::int64_t local_second = second + get_utc_offset(second);
+	const std::int64_t days			= floor_divide(local_second, SECONDS_PER_DAY);
+	const std::int64_t day_second	= local_second - days * SECONDS_PER_DAY;
+
+	// Civil date from the number of days since the epoch (proleptic Gregorian calendar, eras of 400 years).
+	const std::int64_t	shifted_days = days + 719'468L;
+	const std::int64_t	era			 = floor_divide(shifted_days, 146'097L);
+	const std::int64_t	day_era		 = shifted_days - era * 146'097L;
+	const std::int64_t	year_era	 = (day_era - day_era / 1'460L + day_era / 36'524L - day_era / 146'096L) / 365L;
+	const std::int64_t	day_march	 = day_era - (365L * year_era + year_era / 4L - year_era / 100L);
+	const std::int64_t	month_march	 = (5L * day_march + 2L) / 153L;
+	const std::int32_t	month		 = static_cast<std::int32_t>(10L > month_march ? month_march + 2L : month_march - 10L);
+	const std::int64_t	year		 = year_era + era * 400L + (2 > month ? 1L : 0L);
+	const bool			leap_year	 = 0L == year % 4L && (0L != year % 100L || 0L == year % 400L);
+	calendar			time		 = {};
+
+	time.year	   = year;
+	time.month	   = month;
+	time.day_month = static_cast<std::int32_t>(day_march - (153L * month_march + 2L) / 5L + 1L);
+	time.day_year  = DAYS_BEFORE_MONTH[month] + time.day_month - 1 + (true == leap_year && 1 < month ? 1 : 0);
+	time.day_week  = static_cast<std::int32_t>(days + 4L - floor_divide(days + 4L, 7L) * 7L);
+	time.hour	   = static_cast<std::int32_t>(day_second / 3'600L);
+	time.minute	   = static_cast<std::int32_t>(day_second % 3'600L / 60L);
+	time.second	   = static_cast<std::int32_t>(day_second % 60L);
+
+	assert(0 <= time.month && 12 > time.month);
+	assert(0 <= time.day_year && 366 > time.day_year);
+	assert(0 <= time.day_week && 7 > time.day_week);
+
+	return time;
+}
+
+static void append_integer(std::string& destination, const std::int64_t value, const std::size_t width) noexcept(false)
+{
+	std::array<char, 20UL>	   buffer = {};
+	const std::to_chars_result result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+	const std::size_t		   length = static_cast<std::size_t>(result.ptr - buffer.data());
+
+	assert(std::errc{} == result.ec);
+
+	if (width > length)
+	{
+		(void)destination.append(width - length, '0');
+	}
+
+	(void)destination.append(buffer.data(), length);
+}
+
+} /*< namespace hob::log */
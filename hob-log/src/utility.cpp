@@ -39,24 +39,9 @@
 namespace hob::log
 {
 
-void utility::replace_placeholder(std::string& destination, const std::string_view placeholder, const std::string_view replacement) noexcept(false)
+std::int64_t utility::get_timestamp(void) noexcept
 {
-	std::size_t position = 0UL;
-
-	while (std::string::npos != (position = destination.find(placeholder, position)))
-	{
-		destination.replace(position, placeholder.length(), replacement);
-		position += replacement.length();
-	}
-}
-
-std::pair<std::tm*, std::int64_t> utility::get_time(void) noexcept
-{
-	std::chrono::time_point<std::chrono::system_clock> now		  = std::chrono::system_clock::now();
-	std::time_t										   now_time	  = std::chrono::system_clock::to_time_t(now);
-	std::tm* const									   local_time = std::localtime(&now_time);
-
-	return { local_time, std::chrono::milliseconds{ std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000 }.count() };
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 }
 
 } /*< namespace hob::log */
@@ -31,74 +31,120 @@
  *****************************************************************************************************/
 
 #include <functional>
+#include <array>
+#include <algorithm>
 
 #include "worker.hpp"
+#include "backend.hpp"
 #include "utility.hpp"
 
+namespace hob::log
+{
+
 /******************************************************************************************************
- * METHOD DEFINITIONS
+ * CONSTANTS
  *****************************************************************************************************/
 
-namespace hob::log
-{
+/** ***************************************************************************************************
+ * @brief The maximum number of messages taken from the queue at once.
+ *****************************************************************************************************/
+static constexpr std::size_t BATCH_CAPACITY = 256UL;
 
-worker::worker(callback&& callback, std::atomic<std::uint64_t>& lost_logs_count) noexcept
+/******************************************************************************************************
+ * METHOD DEFINITIONS
+ *****************************************************************************************************/
+
+worker::worker(callback&& callback, std::atomic<std::uint64_t>& lost_logs_count, std::unique_ptr<log_queue> queue) noexcept(false)
 	: log_function{ std::move(callback) }
 	, lost_logs_count{ lost_logs_count }
-	, queue{}
-	, is_working{ true }
-	, thread{ std::bind(&worker::log_messages, this) }
+	, queue{ std::move(queue) }
+	, backend_notifier{ backend::attach(*this) }
 {
 }
 
 worker::~worker(void) noexcept
 {
-	is_working = false;
-	queue.interrupt_wait();
+	backend::detach(*this);
 
-	if (true == thread.joinable())
+	while (0UL != log_batch(BATCH_CAPACITY))
 	{
-		thread.join();
 	}
+}
+
+bool worker::log(const record& record) noexcept
+{
+	assert(nullptr != this);
 
-	while (false == queue.is_empty())
+	if (false == queue->emplace(record))
 	{
-		log_message();
+		return false;
 	}
+
+	backend_notifier.notify();
+	return true;
 }
 
-bool worker::log(const std::uint8_t severity_bit, std::string&& message) noexcept
+bool worker::log(const details::callsite* const callsite, const std::shared_ptr<const std::string>& line) noexcept
 {
 	assert(nullptr != this);
-	assert(true == is_working);
 
-	return queue.emplace(severity_bit, std::move(message));
+	if (false == queue->emplace(callsite, line))
+	{
+		return false;
+	}
+
+	backend_notifier.notify();
+	return true;
 }
 
-void worker::log_messages(void) noexcept
+std::size_t worker::log_messages(const std::size_t budget) noexcept
 {
+	std::size_t logged_count = 0UL;
+	std::size_t batch_count	 = 0UL;
+
 	assert(nullptr != this);
-	assert(true == is_working);
 
-	while (true == is_working || false == queue.is_empty())
+	while (logged_count < budget)
 	{
-		log_message();
+		batch_count = log_batch(std::min(budget - logged_count, BATCH_CAPACITY));
+		if (0UL == batch_count)
+		{
+			break;
+		}
+
+		logged_count += batch_count;
 	}
+
+	return logged_count;
 }
 
-void worker::log_message(void) noexcept
+bool worker::is_empty(void) const noexcept
 {
-	std::optional<message_queue::payload> message = queue.pop();
+	assert(nullptr != this);
+	return queue->is_empty();
+}
+
+std::size_t worker::log_batch(const std::size_t capacity) noexcept
+{
+	std::array<const stored_record*, BATCH_CAPACITY> records	 = {};
+	const std::size_t								 batch_count = queue->front(std::span{ records }.first(std::min(capacity, BATCH_CAPACITY)));
+	std::size_t										 index		 = 0UL;
 
 	assert(nullptr != this);
-	assert(true == is_working || false == queue.is_empty());
 
-	if (false == message.has_value())
+	if (0UL == batch_count)
+	{
+		return 0UL;
+	}
+
+	for (index = log_function(std::span{ records }.first(batch_count)); index < batch_count; ++index)
 	{
-		return;
+		lost_logs_count += UINT64_MAX > lost_logs_count ? 1UL : 0UL;
+		(void)records[index]->get().callsite->dropped_count.fetch_add(1UL, std::memory_order_relaxed);
 	}
 
-	lost_logs_count += false == log_function(message->first, std::move(message->second)) ? UINT64_MAX > lost_logs_count ? 1UL : 0UL : 0UL;
+	queue->pop(batch_count);
+	return batch_count;
 }
 
 } /*< namespace hob::log */
@@ -0,0 +1,359 @@
+/******************************************************************************************************
+ * Copyright (C) 2026 Gaina Stefan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ * OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
+#include <print>
+#include <exception>
+
+#include "types.hpp"
+#include "message_queue.hpp"
+#include "merging_queue.hpp"
+#include "notifier.hpp"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many messages every producer thread sends.
+ *****************************************************************************************************/
+static constexpr std::size_t MESSAGES_PER_PRODUCER = 200'000UL;
+
+/** ***************************************************************************************************
+ * @brief The numbers of producer threads the queues are measured with.
+ *****************************************************************************************************/
+static constexpr std::size_t PRODUCER_COUNTS[] = { 1UL, 2UL, 4UL, 8UL, 16UL, 32UL };
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The queue the asynchronous sinks used before the lock-free ring: an unbounded STL queue
+ * guarded by one mutex, signalling its consumer through a condition variable on every emplace.
+ *****************************************************************************************************/
+class mutex_queue final
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Creates an empty queue.
+	 *************************************************************************************************/
+	mutex_queue(void) noexcept
+		: queue{}
+		, mutex{}
+		, condition{}
+		, is_interrupted{ false }
+		, current{}
+	{
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Copies the record at the end of the queue.
+	 *************************************************************************************************/
+	[[nodiscard]] bool emplace(const hob::log::record& record) noexcept
+	{
+		std::lock_guard<std::mutex> lock = std::lock_guard{ mutex };
+
+		try
+		{
+			queue.emplace().assign(record);
+			condition.notify_one();
+
+			return true;
+		}
+		catch (const std::bad_alloc&)
+		{
+			return false;
+		}
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Checks if the queue has any record stored in it.
+	 *************************************************************************************************/
+	[[nodiscard]] bool is_empty(void) const noexcept
+	{
+		std::lock_guard<std::mutex> lock = std::lock_guard{ mutex };
+		return queue.empty();
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Moves the record at the beginning of the queue out of it, waiting for one if the queue is
+	 * empty (returns nullptr if the wait has been interrupted).
+	 *************************************************************************************************/
+	[[nodiscard]] const hob::log::stored_record* front(void) noexcept
+	{
+		std::unique_lock<std::mutex> lock = std::unique_lock{ mutex };
+
+		if (true == queue.empty() && false == is_interrupted)
+		{
+			condition.wait(lock);
+		}
+
+		if (true == queue.empty())
+		{
+			return nullptr;
+		}
+
+		current = std::move(queue.front());
+		queue.pop();
+
+		return &current;
+	}
+
+	/** ***********************************************************************************************
+	 * @brief The record has already been removed by front().
+	 *************************************************************************************************/
+	void pop(void) noexcept
+	{
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Wakes the consumer up, its next waits returning right away.
+	 *************************************************************************************************/
+	void interrupt_wait(void) noexcept
+	{
+		std::lock_guard<std::mutex> lock = std::lock_guard{ mutex };
+
+		is_interrupted = true;
+		condition.notify_one();
+	}
+
+private:
+	std::queue<hob::log::stored_record> queue;
+	mutable std::mutex					mutex;
+	std::condition_variable				condition;
+	bool								is_interrupted;
+	hob::log::stored_record				current;
+};
+
+/** ***************************************************************************************************
+ * @brief The outcome of a run.
+ *****************************************************************************************************/
+struct result final
+{
+	double		  emplace_time;		   /**< Average nanoseconds a producer spent in one emplace() call.	*/
+	double		  messages_per_second; /**< Messages that reached the consumer per second of the run.	*/
+	std::uint64_t lost_count;		   /**< Messages rejected because the queue was full.				*/
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The call site the benchmarked messages are logged from.
+ *****************************************************************************************************/
+static constinit hob::log::details::callsite callsite = {
+	hob::log::severity_level::INFO, "info", __FILE__, "main.cpp", "producer", __LINE__, hob::log::details::callsite::ENABLED
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Sends messages from the given number of producer threads to one consumer thread, which
+ * sleeps on a notifier when the queue is empty (the way the backend threads do). The baseline queue
+ * keeps signalling its consumer itself, the way the worker threads did.
+ * @tparam QUEUE: The queue being measured.
+ * @tparam ARGUMENTS: The types of the arguments of the constructor of the queue.
+ * @param producer_count: The number of producer threads.
+ * @param arguments: The arguments the queue is being constructed with.
+ * @returns The throughput and the number of lost messages.
+ * @throws std::system_error: If the threads can not be created.
+ *****************************************************************************************************/
+template<typename QUEUE, typename... ARGUMENTS>
+static result run(const std::size_t producer_count, const ARGUMENTS... arguments) noexcept(false)
+{
+	using clock = std::chrono::steady_clock;
+
+	static constexpr bool IS_BASELINE = std::is_same_v<QUEUE, mutex_queue>;
+
+	QUEUE						  queue			 = QUEUE{ arguments... };
+	hob::log::notifier			  notifier		 = {};
+	std::vector<std::thread>	  producers		 = {};
+	std::atomic<std::uint64_t>	  lost_count	 = 0UL;
+	std::atomic<std::int64_t>	  emplace_time	 = 0L;
+	std::uint64_t				  consumed_count = 0UL;
+	std::atomic<bool>			  is_started	 = false;
+	std::atomic<bool>			  is_produced	 = false;
+	clock::time_point			  start			 = {};
+	std::chrono::duration<double> duration		 = {};
+	std::thread					  consumer		 = {};
+
+	consumer = std::thread{ [&queue, &notifier, &consumed_count, &is_produced](void) -> void {
+		std::uint32_t wake_value = 0U;
+		bool		  is_last	 = false;
+
+		while (true)
+		{
+			is_last = is_produced.load(std::memory_order_acquire);
+
+			if (nullptr != queue.front())
+			{
+				++consumed_count;
+				queue.pop();
+				continue;
+			}
+
+			if (true == is_last)
+			{
+				break;
+			}
+
+			if constexpr (true == IS_BASELINE)
+			{
+				continue;
+			}
+
+			wake_value = notifier.prepare_wait();
+			if (true == queue.is_empty() && false == is_produced.load(std::memory_order_acquire))
+			{
+				notifier.wait(wake_value);
+				continue;
+			}
+
+			notifier.cancel_wait();
+		}
+	} };
+
+	for (std::size_t producer = 0UL; producer < producer_count; ++producer)
+	{
+		producers.emplace_back([&queue, &notifier, &lost_count, &emplace_time, &is_started](void) -> void {
+			const hob::log::record record = { &callsite, 0UL, 0UL, "1", "producer", "{}", nullptr, "x", false, "", "", "" };
+			std::uint64_t		   lost	  = 0UL;
+			clock::time_point	   start  = {};
+
+			while (false == is_started.load(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+
+			start = clock::now();
+			for (std::size_t message = 0UL; message < MESSAGES_PER_PRODUCER; ++message)
+			{
+				if (false == queue.emplace(record))
+				{
+					++lost;
+					continue;
+				}
+
+				if constexpr (false == IS_BASELINE)
+				{
+					notifier.notify();
+				}
+			}
+
+			(void)emplace_time.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count(), std::memory_order_relaxed);
+			(void)lost_count.fetch_add(lost, std::memory_order_relaxed);
+		});
+	}
+
+	start = clock::now();
+	is_started.store(true, std::memory_order_release);
+
+	for (std::thread& producer : producers)
+	{
+		producer.join();
+	}
+
+	is_produced.store(true, std::memory_order_release);
+	if constexpr (true == IS_BASELINE)
+	{
+		queue.interrupt_wait();
+	}
+	else
+	{
+		notifier.interrupt();
+	}
+	consumer.join();
+	duration = clock::now() - start;
+
+	return { static_cast<double>(emplace_time.load()) / static_cast<double>(producer_count * MESSAGES_PER_PRODUCER),
+			 static_cast<double>(consumed_count) / duration.count(), lost_count.load() };
+}
+
+/******************************************************************************************************
+ * ENTRY POINT
+ *****************************************************************************************************/
+
+std::int32_t main(const std::int32_t argument_count, char** const arguments) noexcept
+{
+	std::size_t			   capacity	  = hob::log::DEFAULT_QUEUE_CAPACITY;
+	std::string_view	   argument	  = "";
+	std::from_chars_result parsing	  = {};
+	result				   baseline	  = {};
+	result				   ring		  = {};
+	result				   per_thread = {};
+
+	try
+	{
+		if (1 < argument_count)
+		{
+			argument = arguments[1];
+			parsing	 = std::from_chars(argument.data(), argument.data() + argument.length(), capacity);
+
+			if (std::errc{} != parsing.ec || argument.data() + argument.length() != parsing.ptr)
+			{
+				std::println(stderr, "The queue capacity is invalid! (argument: \"{}\")", argument);
+				return EXIT_FAILURE;
+			}
+		}
+
+		std::println("{} messages per producer, queue capacity: {} (per producer for the per-thread queues)", MESSAGES_PER_PRODUCER,
+					 hob::log::message_queue{ capacity }.get_capacity());
+		std::println("{:>9} | {:>9} {:>12} | {:>9} {:>12} {:>9} | {:>9} {:>12} {:>9}", "producers", "mutex ns", "mutex msg/s", "ring ns", "ring msg/s", "ring lost",
+					 "thread ns", "thread msg/s", "thread lost");
+
+		for (const std::size_t producer_count : PRODUCER_COUNTS)
+		{
+			baseline   = run<mutex_queue>(producer_count);
+			ring	   = run<hob::log::message_queue>(producer_count, capacity);
+			per_thread = run<hob::log::merging_queue>(producer_count, capacity, hob::log::timestamp_source::TSC);
+
+			std::println("{:>9} | {:>9.1f} {:>12.0f} | {:>9.1f} {:>12.0f} {:>9} | {:>9.1f} {:>12.0f} {:>9}", producer_count, baseline.emplace_time,
+						 baseline.messages_per_second, ring.emplace_time, ring.messages_per_second, ring.lost_count, per_thread.emplace_time,
+						 per_thread.messages_per_second, per_thread.lost_count);
+		}
+
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception& exception)
+	{
+		std::println(stderr, "The benchmark failed! (error message: \"{}\")", exception.what());
+		return EXIT_FAILURE;
+	}
+}
@@ -32,7 +32,7 @@
 
 HOB_APITEST(FATAL, sink_name, message)
 {
-	HOB_LOG_FATAL(sink_name, message);
+	HOB_LOG_FATAL(sink_name, "{}", message);
 }
 
 HOB_APITEST(initialize, configuration_file_path)
@@ -41,6 +41,64 @@ HOB_APITEST(initialize, configuration_file_path)
 	std::println("hob-log has been initialized successfully!");
 }
 
+HOB_APITEST(set_callsites_enabled, file_pattern, function_pattern, first_line, last_line, enabled)
+{
+	hob::log::set_callsites_enabled(hob::log::callsite_filter{ file_pattern, function_pattern, first_line, last_line }, enabled);
+	std::println("The call sites have been {} successfully!", true == static_cast<bool>(enabled) ? "enabled" : "disabled");
+}
+
+HOB_APITEST(reset_callsites)
+{
+	hob::log::reset_callsites();
+	std::println("The call sites have been reset successfully!");
+}
+
+HOB_APITEST(print_noisiest_callsites, count)
+{
+	for (const hob::log::callsite_statistics& statistics : hob::log::get_noisiest_callsites(count))
+	{
+		std::println("{}:{} {} [{}] messages: {} bytes: {} filtered: {} dropped: {}",
+					 statistics.file_path,
+					 statistics.line,
+					 statistics.function_name,
+					 statistics.tag,
+					 statistics.messages_count,
+					 statistics.bytes_count,
+					 statistics.filtered_count,
+					 statistics.dropped_count);
+	}
+}
+
+HOB_APITEST(set_category_level, category_name, severity_level)
+{
+	hob::log::set_category_level(category_name, severity_level);
+	std::println("The severity level of \"{}\" has been set successfully!", category_name);
+}
+
+HOB_APITEST(set_category_sink, category_name, sink_name)
+{
+	hob::log::set_category_sink(category_name, sink_name);
+	std::println("\"{}\" has been routed to \"{}\" successfully!", category_name, sink_name);
+}
+
+HOB_APITEST(add_route, category_name, severity_level, sink_name)
+{
+	hob::log::add_route(category_name, severity_level, sink_name);
+	std::println("The route of \"{}\" to \"{}\" has been added successfully!", category_name, sink_name);
+}
+
+HOB_APITEST(clear_routes)
+{
+	hob::log::clear_routes();
+	std::println("The routes have been cleared successfully!");
+}
+
+HOB_APITEST(set_backend_thread_count, count)
+{
+	hob::log::set_backend_thread_count(count);
+	std::println("The async sinks are being served by {} thread(s)!", hob::log::get_backend_thread_count());
+}
+
 HOB_APITEST(add_sink_terminal, sink_name, format, time_format, severity_level, async_mode, stream, color)
 {
 	hob::log::add_sink(sink_name, hob::log::sink_terminal_configuration{ { format, time_format, severity_level, async_mode }, stream, color });
@@ -0,0 +1,255 @@
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "test_record.hpp"
+
+#include "types.hpp"
+#include "backend.cpp"
+#include "notifier.cpp"
+#include "worker.cpp"
+#include "message_queue.cpp"
+#include "record.cpp"
+#include "utility.cpp"
+
+/** ***************************************************************************************************
+ * @brief Collects what the backend threads log, together with the threads that logged it.
+ *****************************************************************************************************/
+class journal final
+{
+public:
+	hob::log::worker::callback make_callback(const std::string_view prefix)
+	{
+		return [this, prefix](const std::span<const hob::log::stored_record* const> records) -> std::size_t {
+			std::lock_guard<std::mutex> lock = std::lock_guard{ mutex };
+
+			for (const hob::log::stored_record* const record : records)
+			{
+				entries.push_back(std::string{ prefix } + std::string{ record->get().arguments });
+				thread_ids.push_back(std::this_thread::get_id());
+			}
+
+			batch_sizes.push_back(records.size());
+			return records.size();
+		};
+	}
+
+	void wait_for(const std::size_t count)
+	{
+		std::unique_lock<std::mutex> lock = std::unique_lock{ mutex };
+
+		while (count > entries.size())
+		{
+			lock.unlock();
+			std::this_thread::yield();
+			lock.lock();
+		}
+	}
+
+	std::mutex					 mutex		 = {};
+	std::vector<std::string>	 entries	 = {};
+	std::vector<std::thread::id> thread_ids	 = {};
+	std::vector<std::size_t>	 batch_sizes = {};
+};
+
+TEST(backend_test, set_thread_count_is_rejected_while_workers_are_attached)
+{
+	journal					   journal		   = {};
+	std::atomic<std::uint64_t> lost_logs_count = 0UL;
+
+	ASSERT_THROW(hob::log::backend::set_thread_count(0UL), std::invalid_argument);
+	ASSERT_EQ(1UL, hob::log::backend::get_thread_count());
+
+	{
+		hob::log::worker worker = { journal.make_callback(""), lost_logs_count, std::make_unique<hob::log::message_queue>(16UL) };
+		ASSERT_THROW(hob::log::backend::set_thread_count(2UL), std::logic_error);
+	}
+
+	hob::log::backend::set_thread_count(2UL);
+	ASSERT_EQ(2UL, hob::log::backend::get_thread_count());
+	hob::log::backend::set_thread_count(1UL);
+}
+
+TEST(backend_test, workers_share_one_thread_and_log_everything)
+{
+	journal					   journal		   = {};
+	std::atomic<std::uint64_t> lost_logs_count = 0UL;
+
+	{
+		hob::log::worker first	= { journal.make_callback("a"), lost_logs_count, std::make_unique<hob::log::message_queue>(1024UL) };
+		hob::log::worker second = { journal.make_callback("b"), lost_logs_count, std::make_unique<hob::log::message_queue>(1024UL) };
+
+		for (std::size_t message = 0UL; message < 100UL; ++message)
+		{
+			ASSERT_TRUE(first.log(make_record(std::to_string(message))));
+			ASSERT_TRUE(second.log(&callsite, std::make_shared<const std::string>("line\n")));
+		}
+	}
+
+	ASSERT_EQ(200UL, journal.entries.size());
+	ASSERT_EQ(0UL, lost_logs_count);
+	for (std::size_t message = 0UL, index = 0UL; index < journal.entries.size(); ++index)
+	{
+		if ('a' == journal.entries[index][0])
+		{
+			ASSERT_EQ("a" + std::to_string(message++), journal.entries[index]);
+		}
+	}
+
+	// Whatever has not been logged by the backend thread is logged on the calling thread by the destructors.
+	std::erase(journal.thread_ids, std::this_thread::get_id());
+	ASSERT_TRUE(std::ranges::all_of(journal.thread_ids, [&journal](const std::thread::id thread_id) -> bool { return journal.thread_ids.front() == thread_id; }));
+}
+
+TEST(backend_test, workers_are_spread_over_the_threads)
+{
+	journal					   journal		   = {};
+	std::atomic<std::uint64_t> lost_logs_count = 0UL;
+
+	hob::log::backend::set_thread_count(2UL);
+	{
+		hob::log::worker first	= { journal.make_callback("a"), lost_logs_count, std::make_unique<hob::log::message_queue>(16UL) };
+		hob::log::worker second = { journal.make_callback("b"), lost_logs_count, std::make_unique<hob::log::message_queue>(16UL) };
+
+		ASSERT_TRUE(first.log(make_record("")));
+		ASSERT_TRUE(second.log(make_record("")));
+
+		journal.wait_for(2UL);
+	}
+	hob::log::backend::set_thread_count(1UL);
+
+	ASSERT_NE(journal.thread_ids[0], journal.thread_ids[1]);
+	ASSERT_NE(std::this_thread::get_id(), journal.thread_ids[0]);
+	ASSERT_NE(std::this_thread::get_id(), journal.thread_ids[1]);
+}
+
+TEST(backend_test, busy_worker_does_not_starve_the_others)
+{
+	static constexpr std::size_t MESSAGES_COUNT	 = 1000UL;
+	journal						 journal		 = {};
+	std::atomic<std::uint64_t>	 lost_logs_count = 0UL;
+	std::atomic<bool>			 is_blocked		 = true;
+	std::atomic<bool>			 is_entered		 = false;
+	hob::log::worker::callback	 busy_callback	 = journal.make_callback("a");
+	std::size_t					 index			 = 0UL;
+
+	{
+		hob::log::worker busy  = { [&](const std::span<const hob::log::stored_record* const> records) -> std::size_t
+								   {
+									   // Holds the backend thread until the busy worker has a backlog.
+									   is_entered = true;
+									   while (true == is_blocked)
+									   {
+										   std::this_thread::yield();
+									   }
+									   return busy_callback(records);
+								   },
+								   lost_logs_count,
+								   std::make_unique<hob::log::message_queue>(2UL * MESSAGES_COUNT) };
+		hob::log::worker quiet = { journal.make_callback("b"), lost_logs_count, std::make_unique<hob::log::message_queue>(16UL) };
+
+		ASSERT_TRUE(busy.log(make_record("0")));
+		while (false == is_entered)
+		{
+			std::this_thread::yield();
+		}
+
+		for (std::size_t message = 1UL; message < MESSAGES_COUNT; ++message)
+		{
+			ASSERT_TRUE(busy.log(make_record(std::to_string(message))));
+		}
+		ASSERT_TRUE(quiet.log(make_record("quiet")));
+		is_blocked = false;
+
+		journal.wait_for(MESSAGES_COUNT + 1UL);
+	}
+
+	ASSERT_EQ(MESSAGES_COUNT + 1UL, journal.entries.size());
+	index = static_cast<std::size_t>(std::ranges::find(journal.entries, "bquiet") - journal.entries.begin());
+	ASSERT_GT(MESSAGES_COUNT, index);
+}
+
+TEST(backend_test, backlog_is_logged_in_one_batch)
+{
+	journal					   journal			= {};
+	std::atomic<std::uint64_t> lost_logs_count	= 0UL;
+	std::atomic<bool>		   is_blocked		= true;
+	std::atomic<bool>		   is_entered		= false;
+	hob::log::worker::callback forward_callback	= journal.make_callback("");
+
+	{
+		hob::log::worker worker = { [&](const std::span<const hob::log::stored_record* const> records) -> std::size_t
+									{
+										// Holds the backend thread until the worker has a backlog.
+										is_entered = true;
+										while (true == is_blocked)
+										{
+											std::this_thread::yield();
+										}
+										return forward_callback(records);
+									},
+									lost_logs_count,
+									std::make_unique<hob::log::message_queue>(128UL) };
+
+		ASSERT_TRUE(worker.log(make_record("0")));
+		while (false == is_entered)
+		{
+			std::this_thread::yield();
+		}
+
+		for (std::size_t message = 1UL; message < 100UL; ++message)
+		{
+			ASSERT_TRUE(worker.log(make_record(std::to_string(message))));
+		}
+		is_blocked = false;
+
+		journal.wait_for(100UL);
+	}
+
+	ASSERT_EQ(100UL, journal.entries.size());
+	ASSERT_EQ(0UL, lost_logs_count);
+	ASSERT_EQ((std::vector<std::size_t>{ 1UL, 99UL }), journal.batch_sizes);
+}
+
+TEST(backend_test, worker_is_attached_while_another_one_is_being_served)
+{
+	journal					   journal			= {};
+	std::atomic<std::uint64_t> lost_logs_count	= 0UL;
+	std::atomic<bool>		   is_blocked		= true;
+	std::atomic<bool>		   is_entered		= false;
+	hob::log::worker::callback forward_callback	= journal.make_callback("a");
+
+	{
+		hob::log::worker busy = { [&](const std::span<const hob::log::stored_record* const> records) -> std::size_t
+								  {
+									  // Holds the backend thread inside the busy worker's service.
+									  is_entered = true;
+									  while (true == is_blocked)
+									  {
+										  std::this_thread::yield();
+									  }
+									  return forward_callback(records);
+								  },
+								  lost_logs_count,
+								  std::make_unique<hob::log::message_queue>(16UL) };
+
+		ASSERT_TRUE(busy.log(make_record("0")));
+		while (false == is_entered)
+		{
+			std::this_thread::yield();
+		}
+
+		{
+			hob::log::worker quiet = { journal.make_callback("b"), lost_logs_count, std::make_unique<hob::log::message_queue>(16UL) };
+			ASSERT_TRUE(quiet.log(make_record("quiet")));
+		}
+		is_blocked = false;
+
+		journal.wait_for(2UL);
+	}
+
+	ASSERT_EQ((std::vector<std::string>{ "bquiet", "a0" }), journal.entries);
+}
@@ -0,0 +1,93 @@
+#include <array>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "arguments.hpp"
+
+template<std::size_t LENGTH>
+static std::array<std::byte, LENGTH> make_bytes(const char (&characters)[LENGTH + 1UL])
+{
+	std::array<std::byte, LENGTH> bytes = {};
+
+	for (std::size_t index = 0UL; index < LENGTH; ++index)
+	{
+		bytes[index] = static_cast<std::byte>(characters[index]);
+	}
+
+	return bytes;
+}
+
+static std::string render(const hob::log::blob& blob)
+{
+	std::string destination = "";
+
+	(void)hob::log::details::render_blob(std::back_inserter(destination), blob);
+	return destination;
+}
+
+TEST(blob_test, base64_matches_reference_vectors)
+{
+	ASSERT_EQ("", render(hob::log::base64({})));
+	ASSERT_EQ("Zg==", render(hob::log::base64(make_bytes<1UL>("f"))));
+	ASSERT_EQ("Zm8=", render(hob::log::base64(make_bytes<2UL>("fo"))));
+	ASSERT_EQ("Zm9v", render(hob::log::base64(make_bytes<3UL>("foo"))));
+	ASSERT_EQ("Zm9vYg==", render(hob::log::base64(make_bytes<4UL>("foob"))));
+	ASSERT_EQ("Zm9vYmFy", render(hob::log::base64(make_bytes<6UL>("foobar"))));
+}
+
+TEST(blob_test, hexdump_renders_rows)
+{
+	const std::array<std::byte, 18UL> bytes = make_bytes<18UL>("Heap of Battle\x00\x01\xFF\n");
+
+	ASSERT_EQ("18 bytes:\n"
+			  "00000000  48 65 61 70 20 6f 66 20  42 61 74 74 6c 65 00 01  |Heap of Battle..|\n"
+			  "00000010  ff 0a                                             |..|",
+			  render(hob::log::hexdump(bytes)));
+}
+
+TEST(blob_test, truncation_limits_bytes)
+{
+	const std::array<std::byte, 6UL> bytes	= make_bytes<6UL>("foobar");
+	const hob::log::blob			 blob	= hob::log::base64(bytes, 3UL);
+
+	ASSERT_EQ(3UL, blob.bytes.size());
+	ASSERT_EQ(6UL, blob.length);
+	ASSERT_EQ("Zm9v... (3 more bytes)", render(blob));
+	ASSERT_EQ("6 bytes:\n00000000  66 6f" + std::string(45UL, ' ') + "|fo|\n... (4 more bytes)", render(hob::log::hexdump(bytes, 2UL)));
+}
+
+TEST(blob_test, encoding_copies_bytes)
+{
+	std::array<std::byte, 6UL> bytes	 = make_bytes<6UL>("foobar");
+	std::string				   arguments = "";
+	std::string				   message	 = "";
+
+	hob::log::details::serialize_argument(arguments, hob::log::base64(bytes, 4UL));
+	bytes.fill(std::byte{ 0 });
+
+	hob::log::details::deserialize<hob::log::blob>(message, "payload: {}", arguments);
+	ASSERT_EQ("payload: Zm9vYg==... (2 more bytes)", message);
+}
+
+TEST(blob_test, only_owned_arguments_are_encoded)
+{
+	enum class level : std::uint8_t
+	{
+		LOW,
+		HIGH
+	};
+	using iterator = std::array<int, 4UL>::const_iterator;
+
+	ASSERT_TRUE(hob::log::details::is_serializable_v<int>);
+	ASSERT_TRUE(hob::log::details::is_serializable_v<const double&>);
+	ASSERT_TRUE(hob::log::details::is_serializable_v<bool>);
+	ASSERT_TRUE(hob::log::details::is_serializable_v<char>);
+	ASSERT_TRUE(hob::log::details::is_serializable_v<level>);
+	ASSERT_TRUE(hob::log::details::is_serializable_v<const char*>);
+	ASSERT_TRUE(hob::log::details::is_serializable_v<std::string_view>);
+	ASSERT_TRUE(hob::log::details::is_serializable_v<hob::log::blob>);
+
+	ASSERT_FALSE(hob::log::details::is_serializable_v<std::span<const int>>);
+	ASSERT_FALSE(hob::log::details::is_serializable_v<iterator>);
+	ASSERT_FALSE(hob::log::details::is_serializable_v<const int*>);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "callsite_registry.cpp"
+#include "utility.cpp"
+
+static constinit hob::log::details::callsite network_send = {
+	hob::log::severity_level::TRACE, "trace", "/src/network/socket.cpp", "socket.cpp", "send", 10, 0U
+};
+
+static constinit hob::log::details::callsite network_receive = {
+	hob::log::severity_level::TRACE, "trace", "/src/network/socket.cpp", "socket.cpp", "receive", 50, 0U
+};
+
+static constinit hob::log::details::callsite render_frame = {
+	hob::log::severity_level::TRACE, "trace", "/src/render/frame.cpp", "frame.cpp", "draw", 10, 0U
+};
+
+class callsite_registry_test : public testing::Test
+{
+protected:
+	void TearDown(void) override
+	{
+		hob::log::callsite_registry::clear_rules();
+	}
+};
+
+TEST_F(callsite_registry_test, registered_enabled_without_rules)
+{
+	EXPECT_TRUE(network_send.is_enabled());
+	EXPECT_EQ(hob::log::details::callsite::ENABLED, network_send.state.load());
+}
+
+TEST_F(callsite_registry_test, disable_by_file_pattern)
+{
+	EXPECT_TRUE(network_send.is_enabled());
+
+	hob::log::callsite_registry::add_rule({ "*/network/*", "", 0, 0 }, false);
+	EXPECT_FALSE(network_send.is_enabled());
+	EXPECT_FALSE(network_receive.is_enabled());
+	EXPECT_TRUE(render_frame.is_enabled());
+
+	hob::log::callsite_registry::clear_rules();
+	EXPECT_TRUE(network_send.is_enabled());
+	EXPECT_TRUE(network_receive.is_enabled());
+}
+
+TEST_F(callsite_registry_test, most_recent_rule_applied)
+{
+	hob::log::callsite_registry::add_rule({ "", "", 0, 0 }, false);
+	hob::log::callsite_registry::add_rule({ "socket.cpp", "receive", 0, 0 }, true);
+
+	EXPECT_FALSE(network_send.is_enabled());
+	EXPECT_TRUE(network_receive.is_enabled());
+	EXPECT_FALSE(render_frame.is_enabled());
+}
+
+TEST_F(callsite_registry_test, disable_by_line_range)
+{
+	hob::log::callsite_registry::add_rule({ "socket.cpp", "", 40, 60 }, false);
+
+	EXPECT_TRUE(network_send.is_enabled());
+	EXPECT_FALSE(network_receive.is_enabled());
+}
+
+TEST_F(callsite_registry_test, add_rule_invalid_range_throws)
+{
+	EXPECT_THROW(hob::log::callsite_registry::add_rule({ "", "", 60, 40 }, false), std::invalid_argument);
+	EXPECT_THROW(hob::log::callsite_registry::add_rule({ "", "", -1, 0 }, false), std::invalid_argument);
+}
+
+TEST_F(callsite_registry_test, get_statistics_orders_by_bytes)
+{
+	EXPECT_TRUE(network_send.is_enabled());
+	EXPECT_TRUE(network_receive.is_enabled());
+	EXPECT_TRUE(render_frame.is_enabled());
+
+	network_send.messages_count	  = 10UL;
+	network_send.bytes_count	  = 100UL;
+	network_receive.messages_count = 5UL;
+	network_receive.bytes_count	  = 500UL;
+	network_receive.dropped_count  = 7UL;
+	render_frame.messages_count	  = 1UL;
+	render_frame.bytes_count	  = 1UL;
+
+	const std::vector<hob::log::callsite_statistics> statistics = hob::log::callsite_registry::get_statistics(2UL);
+
+	ASSERT_EQ(2UL, statistics.size());
+	EXPECT_EQ("receive", statistics[0].function_name);
+	EXPECT_EQ(500UL, statistics[0].bytes_count);
+	EXPECT_EQ(7UL, statistics[0].dropped_count);
+	EXPECT_EQ("send", statistics[1].function_name);
+	EXPECT_EQ(10UL, statistics[1].messages_count);
+}
+
+TEST_F(callsite_registry_test, statistics_do_not_share_cache_line_with_state)
+{
+	const std::uintptr_t state_address		= reinterpret_cast<std::uintptr_t>(&network_send.state);
+	const std::uintptr_t statistics_address = reinterpret_cast<std::uintptr_t>(&network_send.messages_count);
+
+	EXPECT_EQ(0UL, statistics_address % 64UL);
+	EXPECT_NE(state_address / 64UL, statistics_address / 64UL);
+	EXPECT_NE(reinterpret_cast<std::uintptr_t>(&network_receive.state) / 64UL, reinterpret_cast<std::uintptr_t>(&network_send.dropped_count) / 64UL);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "category_registry.cpp"
+
+static std::uint8_t get_level(const hob::log::category_handle category)
+{
+	return category->effective_level.load(std::memory_order_relaxed);
+}
+
+static std::string_view get_sink(const std::string_view name)
+{
+	return *hob::log::categories.find(name)->second.resolved_sink;
+}
+
+static std::uint64_t get_routes(const hob::log::category_handle category, const std::uint8_t severity_bit)
+{
+	return category->get_routes(severity_bit);
+}
+
+class category_registry_test : public testing::Test
+{
+protected:
+	void SetUp(void) override
+	{
+		hob::log::category_registry::set_sinks({ { "terminal", 0x3FU }, { "file", 0x3FU }, { "net", 0x3FU } });
+	}
+
+	void TearDown(void) override
+	{
+		hob::log::categories.clear();
+		hob::log::routes.clear();
+		hob::log::sinks.clear();
+	}
+};
+
+TEST_F(category_registry_test, unrouted_category_accepts_nothing)
+{
+	const hob::log::category_handle category = hob::log::category_registry::get("engine.net");
+
+	ASSERT_EQ(0U, get_level(category));
+	ASSERT_EQ("", get_sink("engine.net"));
+	ASSERT_EQ(category, hob::log::category_registry::get("engine.net"));
+}
+
+TEST_F(category_registry_test, children_inherit_level_and_sink)
+{
+	const hob::log::category_handle lockstep = hob::log::category_registry::get("engine.net.lockstep");
+
+	hob::log::category_registry::set_sink("", "terminal");
+	ASSERT_EQ(0x3FU, get_level(lockstep));
+	ASSERT_EQ("terminal", get_sink("engine.net.lockstep"));
+
+	hob::log::category_registry::set_level("engine", 0x07U);
+	ASSERT_EQ(0x07U, get_level(lockstep));
+	ASSERT_EQ(0x3FU, get_level(hob::log::category_registry::get("")));
+}
+
+TEST_F(category_registry_test, override_stops_propagation)
+{
+	const hob::log::category_handle net		 = hob::log::category_registry::get("engine.net");
+	const hob::log::category_handle lockstep = hob::log::category_registry::get("engine.net.lockstep");
+
+	hob::log::category_registry::set_sink("engine", "file");
+	hob::log::category_registry::set_level("engine.net.lockstep", 0x3FU);
+	hob::log::category_registry::set_level("engine", 0x01U);
+
+	ASSERT_EQ(0x01U, get_level(net));
+	ASSERT_EQ(0x3FU, get_level(lockstep));
+
+	hob::log::category_registry::reset_level("engine.net.lockstep");
+	ASSERT_EQ(0x01U, get_level(lockstep));
+}
+
+TEST_F(category_registry_test, siblings_sharing_prefix_are_not_descendants)
+{
+	const hob::log::category_handle net	 = hob::log::category_registry::get("net");
+	const hob::log::category_handle net2 = hob::log::category_registry::get("net2");
+	const hob::log::category_handle io	 = hob::log::category_registry::get("net-io.socket");
+
+	hob::log::category_registry::set_sink("", "terminal");
+	hob::log::category_registry::set_sink("net", "file");
+	hob::log::category_registry::set_level("net", 0x01U);
+
+	ASSERT_EQ("file", get_sink("net"));
+	ASSERT_EQ("terminal", get_sink("net2"));
+	ASSERT_EQ("terminal", get_sink("net-io.socket"));
+	ASSERT_EQ(0x3FU, get_level(net2));
+
+	hob::log::category_registry::reset_sink("net");
+	ASSERT_EQ("terminal", get_sink("net"));
+	ASSERT_EQ(0x01U, get_level(net));
+}
+
+TEST_F(category_registry_test, invalid_arguments_throw)
+{
+	ASSERT_THROW((void)hob::log::category_registry::get(".engine"), std::invalid_argument);
+	ASSERT_THROW((void)hob::log::category_registry::get("engine."), std::invalid_argument);
+	ASSERT_THROW((void)hob::log::category_registry::get("engine..net"), std::invalid_argument);
+	ASSERT_THROW(hob::log::category_registry::set_level("engine", 64U), std::invalid_argument);
+	ASSERT_THROW(hob::log::category_registry::add_route("engine", 64U, "file"), std::invalid_argument);
+	ASSERT_THROW(hob::log::category_registry::add_route("engine.", 0x01U, "file"), std::invalid_argument);
+}
+
+TEST_F(category_registry_test, routing_table_has_the_sinks_by_severity)
+{
+	const hob::log::category_handle root	 = hob::log::category_registry::get("");
+	const hob::log::category_handle net		 = hob::log::category_registry::get("net");
+	const hob::log::category_handle lockstep = hob::log::category_registry::get("net.lockstep");
+
+	hob::log::category_registry::add_route("", hob::log::severity_level::FATAL | hob::log::severity_level::ERROR, "terminal");
+	hob::log::category_registry::add_route("", hob::log::severity_level::FATAL | hob::log::severity_level::ERROR, "file");
+	hob::log::category_registry::add_route("net", hob::log::severity_level::DEBUG, "net");
+
+	ASSERT_EQ(0x03U, get_level(root));
+	ASSERT_EQ(0b011UL, get_routes(root, hob::log::severity_level::ERROR));
+	ASSERT_EQ(0UL, get_routes(root, hob::log::severity_level::DEBUG));
+
+	ASSERT_EQ(0x13U, get_level(lockstep));
+	ASSERT_EQ(0b011UL, get_routes(lockstep, hob::log::severity_level::FATAL));
+	ASSERT_EQ(0b100UL, get_routes(lockstep, hob::log::severity_level::DEBUG));
+
+	hob::log::category_registry::set_sink("net", "terminal");
+	ASSERT_EQ(0b101UL, get_routes(net, hob::log::severity_level::DEBUG));
+	ASSERT_EQ(0b001UL, get_routes(net, hob::log::severity_level::INFO));
+
+	hob::log::category_registry::clear_routes();
+	ASSERT_EQ(0UL, get_level(root));
+	ASSERT_EQ(0b001UL, get_routes(lockstep, hob::log::severity_level::DEBUG));
+}
+
+TEST_F(category_registry_test, routing_table_follows_the_sinks)
+{
+	const hob::log::category_handle net = hob::log::category_registry::get("net");
+
+	hob::log::category_registry::set_sink("", "file");
+	hob::log::category_registry::add_route("net", 0x3FU, "net");
+	ASSERT_EQ(0b110UL, get_routes(net, hob::log::severity_level::INFO));
+
+	hob::log::category_registry::set_sinks({ { "net", 0x01U }, { "file", 0x3FU } });
+	ASSERT_EQ(0b11UL, get_routes(net, hob::log::severity_level::FATAL));
+	ASSERT_EQ(0b10UL, get_routes(net, hob::log::severity_level::INFO));
+
+	hob::log::category_registry::set_level("net", 0x01U);
+	ASSERT_EQ(0x01U, get_level(net));
+	ASSERT_EQ(0UL, get_routes(net, hob::log::severity_level::INFO));
+
+	hob::log::category_registry::set_sinks({});
+	ASSERT_EQ(0U, get_level(net));
+}
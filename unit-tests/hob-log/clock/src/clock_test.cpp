@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "clock.cpp"
+#include "utility.cpp"
+
+static constexpr std::int64_t MAXIMUM_DIFFERENCE = 5'000'000L;
+
+TEST(clock_test, to_nanoseconds_system_is_identity)
+{
+	const std::uint64_t ticks = hob::log::clock::read(hob::log::timestamp_source::SYSTEM);
+
+	EXPECT_EQ(static_cast<std::int64_t>(ticks), hob::log::clock::to_nanoseconds(hob::log::timestamp_source::SYSTEM, ticks));
+	EXPECT_NEAR(hob::log::utility::get_timestamp(), static_cast<std::int64_t>(ticks), MAXIMUM_DIFFERENCE);
+}
+
+TEST(clock_test, read_realtime_coarse_is_close_to_system)
+{
+	const std::uint64_t ticks = hob::log::clock::read(hob::log::timestamp_source::REALTIME_COARSE);
+
+	EXPECT_NEAR(hob::log::utility::get_timestamp(), hob::log::clock::to_nanoseconds(hob::log::timestamp_source::REALTIME_COARSE, ticks), MAXIMUM_DIFFERENCE);
+}
+
+TEST(clock_test, to_nanoseconds_tsc_is_close_to_system)
+{
+	std::uint64_t ticks = 0UL;
+
+	hob::log::clock::calibrate();
+	ticks = hob::log::clock::read(hob::log::timestamp_source::TSC);
+
+	EXPECT_NEAR(hob::log::utility::get_timestamp(), hob::log::clock::to_nanoseconds(hob::log::timestamp_source::TSC, ticks), MAXIMUM_DIFFERENCE);
+}
+
+TEST(clock_test, to_nanoseconds_tsc_is_monotonic)
+{
+	const std::uint64_t first_ticks	 = hob::log::clock::read(hob::log::timestamp_source::TSC);
+	const std::uint64_t second_ticks = hob::log::clock::read(hob::log::timestamp_source::TSC);
+
+	EXPECT_LE(hob::log::clock::to_nanoseconds(hob::log::timestamp_source::TSC, first_ticks),
+			  hob::log::clock::to_nanoseconds(hob::log::timestamp_source::TSC, second_ticks));
+}
+
+TEST(clock_test, to_nanoseconds_tsc_recalibrates)
+{
+	std::uint64_t ticks = 0UL;
+
+	hob::log::clock::calibrate();
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 1100 });
+	ticks = hob::log::clock::read(hob::log::timestamp_source::TSC);
+
+	EXPECT_NEAR(hob::log::utility::get_timestamp(), hob::log::clock::to_nanoseconds(hob::log::timestamp_source::TSC, ticks), MAXIMUM_DIFFERENCE);
+	EXPECT_LT(2UL, hob::log::sequence.load());
+}
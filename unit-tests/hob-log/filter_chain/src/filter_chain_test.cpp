@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "filter_chain.cpp"
+#include "record.cpp"
+#include "utility.cpp"
+
+static constinit hob::log::details::callsite callsite = {
+	hob::log::severity_level::INFO, "info", "src/net/socket.cpp", "socket.cpp", "net_connect", 1, hob::log::details::callsite::ENABLED
+};
+
+static hob::log::record make_record(const std::string_view message, const std::string_view category)
+{
+	return hob::log::record{ &callsite, 0UL, 0UL, "42", "worker-1", message, nullptr, message, false, category, "", "" };
+}
+
+TEST(filter_chain_test, empty_chain_passes_everything)
+{
+	hob::log::filter_chain filters = {};
+
+	ASSERT_TRUE(filters.passes(make_record("message", "")));
+	ASSERT_TRUE(filters.get_filters().empty());
+}
+
+TEST(filter_chain_test, prefixes_of_file_function_and_thread)
+{
+	hob::log::filter_chain filters = {};
+
+	filters.compile({ { hob::log::sink_filter::field::FILE, "src/net/", false }, { hob::log::sink_filter::field::FUNCTION, "net_", false } });
+	ASSERT_TRUE(filters.passes(make_record("message", "")));
+
+	filters.compile({ { hob::log::sink_filter::field::FILE, "src/ui/", false } });
+	ASSERT_FALSE(filters.passes(make_record("message", "")));
+
+	filters.compile({ { hob::log::sink_filter::field::THREAD, "worker-", false } });
+	ASSERT_TRUE(filters.passes(make_record("message", "")));
+
+	filters.compile({ { hob::log::sink_filter::field::THREAD, "42", false } });
+	ASSERT_TRUE(filters.passes(make_record("message", "")));
+
+	filters.compile({ { hob::log::sink_filter::field::THREAD, "main", false } });
+	ASSERT_FALSE(filters.passes(make_record("message", "")));
+}
+
+TEST(filter_chain_test, category_matches_descendants_only)
+{
+	hob::log::filter_chain filters = {};
+
+	filters.compile({ { hob::log::sink_filter::field::CATEGORY, "net", false } });
+	ASSERT_TRUE(filters.passes(make_record("message", "net")));
+	ASSERT_TRUE(filters.passes(make_record("message", "net.socket")));
+	ASSERT_FALSE(filters.passes(make_record("message", "net2")));
+	ASSERT_FALSE(filters.passes(make_record("message", "")));
+}
+
+TEST(filter_chain_test, message_content_and_exclusion)
+{
+	hob::log::filter_chain filters	 = {};
+	std::string			   arguments = {};
+	hob::log::record	   record	 = make_record("", "net");
+
+	filters.compile({ { hob::log::sink_filter::field::MESSAGE, "heartbeat", true } });
+	ASSERT_FALSE(filters.passes(make_record("heartbeat sent", "")));
+	ASSERT_TRUE(filters.passes(make_record("unit spawned", "")));
+
+	hob::log::details::serialize_argument(arguments, 7);
+	record.format	 = "player {} lost";
+	record.decode	 = &hob::log::details::deserialize<int>;
+	record.arguments = arguments;
+
+	filters.compile({ { hob::log::sink_filter::field::MESSAGE, "player 7", false } });
+	ASSERT_TRUE(filters.passes(record));
+
+	filters.compile({ { hob::log::sink_filter::field::MESSAGE, "player 8", false } });
+	ASSERT_FALSE(filters.passes(record));
+}
+
+TEST(filter_chain_test, content_is_checked_last_but_order_is_kept)
+{
+	hob::log::filter_chain			   filters = {};
+	std::vector<hob::log::sink_filter> result  = {};
+
+	filters.compile({ { hob::log::sink_filter::field::MESSAGE, "spawned", false },
+					  { hob::log::sink_filter::field::CATEGORY, "ui", true },
+					  { hob::log::sink_filter::field::FUNCTION, "net_", false } });
+
+	result = filters.get_filters();
+	ASSERT_EQ(3UL, result.size());
+	ASSERT_EQ(hob::log::sink_filter::field::MESSAGE, result[0].target);
+	ASSERT_EQ("spawned", result[0].pattern);
+	ASSERT_EQ("ui", result[1].pattern);
+	ASSERT_TRUE(result[1].exclude);
+	ASSERT_EQ("net_", result[2].pattern);
+
+	ASSERT_TRUE(filters.passes(make_record("unit spawned", "net")));
+	ASSERT_FALSE(filters.passes(make_record("unit spawned", "ui")));
+	ASSERT_FALSE(filters.passes(make_record("unit lost", "net")));
+}
+
+TEST(filter_chain_test, unknown_field_throws)
+{
+	hob::log::filter_chain filters = {};
+
+	filters.compile({ { hob::log::sink_filter::field::FILE, "src/", false } });
+	ASSERT_THROW(filters.compile({ { static_cast<hob::log::sink_filter::field>(42U), "", false } }), std::invalid_argument);
+	ASSERT_EQ(1UL, filters.get_filters().size());
+}
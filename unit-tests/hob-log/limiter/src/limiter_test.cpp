@@ -0,0 +1,59 @@
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "limiter.hpp"
+
+TEST(limiter_test, every_n_logs_first_of_each_period)
+{
+	hob::log::details::every_n limiter = {};
+
+	EXPECT_TRUE(limiter.should_log(3UL));
+	EXPECT_FALSE(limiter.should_log(3UL));
+	EXPECT_FALSE(limiter.should_log(3UL));
+	EXPECT_TRUE(limiter.should_log(3UL));
+	EXPECT_EQ(2UL, limiter.take_suppressed_count());
+	EXPECT_EQ(0UL, limiter.take_suppressed_count());
+}
+
+TEST(limiter_test, first_n_stops_logging)
+{
+	hob::log::details::first_n limiter = {};
+
+	EXPECT_TRUE(limiter.should_log(2UL));
+	EXPECT_TRUE(limiter.should_log(2UL));
+	for (std::int32_t index = 0; index < 10; ++index)
+	{
+		EXPECT_FALSE(limiter.should_log(2UL));
+	}
+}
+
+TEST(limiter_test, every_interval_logs_after_interval)
+{
+	hob::log::details::every_interval limiter = {};
+
+	EXPECT_TRUE(limiter.should_log(20L));
+	EXPECT_FALSE(limiter.should_log(20L));
+	EXPECT_EQ(1UL, limiter.take_suppressed_count());
+
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 25 });
+	EXPECT_TRUE(limiter.should_log(20L));
+}
+
+TEST(limiter_test, token_bucket_allows_burst)
+{
+	hob::log::details::token_bucket limiter = {};
+
+	EXPECT_TRUE(limiter.should_log(1U, 3U));
+	EXPECT_TRUE(limiter.should_log(1U, 3U));
+	EXPECT_TRUE(limiter.should_log(1U, 3U));
+	EXPECT_FALSE(limiter.should_log(1U, 3U));
+	EXPECT_EQ(1UL, limiter.take_suppressed_count());
+}
+
+TEST(limiter_test, token_bucket_zero_rate_drops)
+{
+	hob::log::details::token_bucket limiter = {};
+
+	EXPECT_FALSE(limiter.should_log(0U, 10U));
+	EXPECT_EQ(1UL, limiter.take_suppressed_count());
+}
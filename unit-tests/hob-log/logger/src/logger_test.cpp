@@ -0,0 +1,83 @@
+#include <atomic>
+#include <new>
+#include <cstdlib>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "logger.cpp"
+#include "sink_manager.cpp"
+#include "sink.cpp"
+#include "sink_base.cpp"
+#include "sink_terminal.cpp"
+#include "sink_json.cpp"
+#include "sink_composed.cpp"
+#include "filter_chain.cpp"
+#include "message_formatter.cpp"
+#include "time_formatter.cpp"
+#include "callsite_registry.cpp"
+#include "category_registry.cpp"
+#include "process.cpp"
+#include "thread_info.cpp"
+#include "worker.cpp"
+#include "backend.cpp"
+#include "notifier.cpp"
+#include "message_queue.cpp"
+#include "merging_queue.cpp"
+#include "thread_queue.cpp"
+#include "record.cpp"
+#include "clock.cpp"
+#include "utility.cpp"
+
+static std::atomic<std::uint64_t> allocations_count = 0UL;
+
+void* operator new(const std::size_t size)
+{
+	void* const memory = std::malloc(0UL == size ? 1UL : size);
+
+	allocations_count.fetch_add(1UL, std::memory_order_relaxed);
+	return nullptr != memory ? memory : throw std::bad_alloc{};
+}
+
+void operator delete(void* const memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* const memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+TEST(logger_test, log_macro_steady_state_does_not_allocate)
+{
+	FILE* const	  stream				  = std::tmpfile();
+	std::uint64_t allocations_count_start = 0UL;
+	std::uint64_t lines_count			  = 0UL;
+
+	ASSERT_NE(nullptr, stream);
+	hob::log::initialize("");
+	hob::log::add_sink("json", hob::log::sink_json_configuration{ { "", "", 0x3FU, false }, stream });
+
+	// The first call registers the call site and grows the buffers, the following ones reuse them.
+	for (std::int32_t index = 0; index < 101; ++index)
+	{
+		if (1 == index)
+		{
+			allocations_count_start = allocations_count.load();
+		}
+
+		HOB_LOG_INFO("json", "steady state {} of {}", index, "the logger");
+	}
+
+	EXPECT_EQ(allocations_count_start, allocations_count.load());
+	hob::log::deinitialize();
+
+	std::rewind(stream);
+	for (std::int32_t character = std::fgetc(stream); EOF != character; character = std::fgetc(stream))
+	{
+		lines_count += '\n' == character ? 1UL : 0UL;
+	}
+
+	EXPECT_EQ(101UL, lines_count);
+	std::fclose(stream);
+}
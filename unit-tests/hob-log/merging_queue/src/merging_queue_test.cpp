@@ -0,0 +1,238 @@
+#include <thread>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "test_record.hpp"
+
+#include "types.hpp"
+#include "merging_queue.cpp"
+#include "thread_queue.cpp"
+#include "record.cpp"
+#include "clock.cpp"
+#include "utility.cpp"
+
+TEST(merging_queue_test, thread_queue_keeps_records_and_keys_in_order)
+{
+	hob::log::thread_queue queue = hob::log::thread_queue{ 4UL };
+
+	ASSERT_TRUE(queue.is_empty());
+	ASSERT_EQ(nullptr, queue.front());
+	ASSERT_TRUE(queue.emplace(make_record("first"), 7UL));
+	ASSERT_TRUE(queue.emplace(&callsite, std::make_shared<const std::string>("second\n"), 3UL));
+
+	ASSERT_EQ("first", queue.front()->get().arguments);
+	ASSERT_EQ(7UL, queue.get_front_key());
+	queue.pop();
+
+	ASSERT_EQ("second\n", *queue.front()->get_line());
+	ASSERT_EQ(3UL, queue.get_front_key());
+	queue.pop();
+
+	ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(merging_queue_test, thread_queue_emplace_fails_when_full)
+{
+	hob::log::thread_queue queue = hob::log::thread_queue{ 2UL };
+
+	ASSERT_TRUE(queue.emplace(make_record("1"), 1UL));
+	ASSERT_TRUE(queue.emplace(make_record("2"), 2UL));
+	ASSERT_FALSE(queue.emplace(make_record("3"), 3UL));
+
+	ASSERT_NE(nullptr, queue.front());
+	queue.pop();
+	ASSERT_TRUE(queue.emplace(make_record("4"), 4UL));
+
+	ASSERT_EQ("2", queue.front()->get().arguments);
+	queue.pop();
+	ASSERT_EQ("4", queue.front()->get().arguments);
+	queue.pop();
+}
+
+TEST(merging_queue_test, thread_queue_flags_the_departure_of_each_side)
+{
+	hob::log::thread_queue queue = hob::log::thread_queue{ 2UL };
+
+	ASSERT_FALSE(queue.is_closed());
+	ASSERT_FALSE(queue.is_abandoned());
+
+	queue.close();
+	queue.abandon();
+
+	ASSERT_TRUE(queue.is_closed());
+	ASSERT_TRUE(queue.is_abandoned());
+}
+
+TEST(merging_queue_test, front_merges_threads_by_timestamp)
+{
+	static constexpr std::uint64_t THREADS_COUNT = 3UL;
+	hob::log::merging_queue		   queue		 = hob::log::merging_queue{ 16UL, hob::log::timestamp_source::SYSTEM };
+	std::vector<std::thread>	   threads		 = {};
+
+	for (std::uint64_t thread = 0UL; thread < THREADS_COUNT; ++thread)
+	{
+		threads.emplace_back([&queue, thread](void) -> void {
+			for (std::uint64_t message = 0UL; message < 4UL; ++message)
+			{
+				const std::uint64_t timestamp = 1UL + message * THREADS_COUNT + thread;
+				const std::string	arguments = std::to_string(timestamp);
+
+				ASSERT_TRUE(queue.emplace(make_record(arguments, timestamp)));
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (std::uint64_t timestamp = 1UL; timestamp <= 4UL * THREADS_COUNT; ++timestamp)
+	{
+		ASSERT_EQ(std::to_string(timestamp), queue.front()->get().arguments);
+		queue.pop();
+	}
+
+	ASSERT_EQ(nullptr, queue.front());
+	ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(merging_queue_test, front_merges_records_without_timestamp_by_clock)
+{
+	hob::log::merging_queue queue = hob::log::merging_queue{ 16UL, hob::log::timestamp_source::SYSTEM };
+
+	ASSERT_TRUE(queue.emplace(make_record("main")));
+	std::thread{ [&queue](void) -> void { ASSERT_TRUE(queue.emplace(&callsite, std::make_shared<const std::string>("other\n"))); } }.join();
+	ASSERT_TRUE(queue.emplace(make_record("main again")));
+
+	ASSERT_EQ("main", queue.front()->get().arguments);
+	queue.pop();
+	ASSERT_EQ("other\n", *queue.front()->get_line());
+	queue.pop();
+	ASSERT_EQ("main again", queue.front()->get().arguments);
+	queue.pop();
+	ASSERT_EQ(nullptr, queue.front());
+}
+
+TEST(merging_queue_test, front_batch_stops_at_the_next_thread)
+{
+	hob::log::merging_queue							queue	= hob::log::merging_queue{ 16UL, hob::log::timestamp_source::SYSTEM };
+	std::array<const hob::log::stored_record*, 8UL>	records	= {};
+
+	ASSERT_TRUE(queue.emplace(make_record("1", 1UL)));
+	ASSERT_TRUE(queue.emplace(make_record("2", 2UL)));
+	std::thread{ [&queue](void) -> void { ASSERT_TRUE(queue.emplace(make_record("3", 3UL))); } }.join();
+	ASSERT_TRUE(queue.emplace(make_record("4", 4UL)));
+	ASSERT_TRUE(queue.emplace(make_record("5", 5UL)));
+
+	ASSERT_EQ(2UL, queue.front(records));
+	ASSERT_EQ("1", records[0]->get().arguments);
+	ASSERT_EQ("2", records[1]->get().arguments);
+	queue.pop(2UL);
+
+	ASSERT_EQ(1UL, queue.front(records));
+	ASSERT_EQ("3", records[0]->get().arguments);
+	queue.pop(1UL);
+
+	ASSERT_EQ(2UL, queue.front(records));
+	ASSERT_EQ("4", records[0]->get().arguments);
+	ASSERT_EQ("5", records[1]->get().arguments);
+	queue.pop(2UL);
+
+	ASSERT_EQ(0UL, queue.front(records));
+	ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(merging_queue_test, producer_releases_queues_of_gone_consumers)
+{
+	hob::log::merging_queue kept = hob::log::merging_queue{ 16UL, hob::log::timestamp_source::SYSTEM };
+
+	// A fresh thread, so only the registrations made by this test are seen.
+	std::thread{ [&kept](void) -> void {
+		const std::vector<hob::log::registration>& registrations = hob::log::current_thread_registrations.registrations;
+
+		{
+			hob::log::merging_queue gone = hob::log::merging_queue{ 16UL, hob::log::timestamp_source::SYSTEM };
+
+			ASSERT_TRUE(gone.emplace(make_record("gone", 1UL)));
+			ASSERT_TRUE(kept.emplace(make_record("kept", 2UL)));
+			ASSERT_EQ(2UL, registrations.size());
+		}
+
+		ASSERT_TRUE(kept.emplace(make_record("kept again", 3UL)));
+		ASSERT_EQ(1UL, registrations.size());
+		ASSERT_FALSE(registrations.front().queue->is_abandoned());
+	} }.join();
+
+	ASSERT_EQ("kept", kept.front()->get().arguments);
+}
+
+TEST(merging_queue_test, consumer_receives_every_record_of_every_producer)
+{
+	static constexpr std::size_t PRODUCERS_COUNT = 8UL;
+	static constexpr std::size_t MESSAGES_COUNT	 = 20'000UL;
+	hob::log::merging_queue		 queue			 = hob::log::merging_queue{ 64UL, hob::log::timestamp_source::SYSTEM };
+	std::vector<std::thread>	 producers		 = {};
+	std::vector<std::size_t>	 next_messages	 = std::vector<std::size_t>(PRODUCERS_COUNT, 0UL);
+	std::size_t					 consumed_count	 = 0UL;
+	std::atomic<bool>			 is_produced	 = false;
+	std::thread					 consumer		 = {};
+
+	consumer = std::thread{ [&queue, &next_messages, &consumed_count, &is_produced](void) -> void {
+		const hob::log::stored_record* record  = nullptr;
+		bool						   is_last = false;
+
+		while (true)
+		{
+			// Read before the queue, so the records emplaced right before the producers are done are not missed.
+			is_last = is_produced.load();
+			record	= queue.front();
+
+			if (nullptr == record)
+			{
+				if (true == is_last)
+				{
+					break;
+				}
+
+				std::this_thread::yield();
+				continue;
+			}
+
+			const std::string_view arguments = record->get().arguments;
+			const std::size_t	   producer	 = static_cast<std::size_t>(arguments[0] - 'a');
+
+			EXPECT_EQ(std::to_string(next_messages[producer]++), arguments.substr(1UL));
+			++consumed_count;
+			queue.pop();
+		}
+	} };
+
+	for (std::size_t producer = 0UL; producer < PRODUCERS_COUNT; ++producer)
+	{
+		producers.emplace_back([&queue, producer](void) -> void {
+			for (std::size_t message = 0UL; message < MESSAGES_COUNT; ++message)
+			{
+				const std::string arguments = static_cast<char>('a' + producer) + std::to_string(message);
+
+				while (false == queue.emplace(make_record(arguments)))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	for (std::thread& producer : producers)
+	{
+		producer.join();
+	}
+
+	is_produced.store(true);
+	consumer.join();
+
+	ASSERT_EQ(PRODUCERS_COUNT * MESSAGES_COUNT, consumed_count);
+	ASSERT_TRUE(queue.is_empty());
+}
@@ -0,0 +1,129 @@
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "callsite.hpp"
+
+#include "message_formatter.cpp"
+#include "process.cpp"
+#include "thread_info.cpp"
+
+TEST(message_formatter_test, compile_without_message_throws)
+{
+	hob::log::message_formatter formatter = {};
+
+	EXPECT_THROW(formatter.compile("[{TAG}] {FUNCTION}"), std::invalid_argument);
+	EXPECT_TRUE(formatter.get_format().empty());
+}
+
+TEST(message_formatter_test, compile_failure_keeps_previous_format)
+{
+	hob::log::message_formatter formatter = {};
+
+	formatter.compile("{MESSAGE}");
+	EXPECT_THROW(formatter.compile("{TAG}"), std::invalid_argument);
+	EXPECT_EQ("{MESSAGE}", formatter.get_format());
+}
+
+TEST(message_formatter_test, contains_only_present_fields)
+{
+	hob::log::message_formatter formatter = {};
+
+	formatter.compile("[{TAG}] {LINE}: {MESSAGE}");
+	EXPECT_TRUE(formatter.contains(hob::log::message_formatter::field::TAG));
+	EXPECT_TRUE(formatter.contains(hob::log::message_formatter::field::LINE));
+	EXPECT_TRUE(formatter.contains(hob::log::message_formatter::field::MESSAGE));
+	EXPECT_FALSE(formatter.contains(hob::log::message_formatter::field::TIME));
+	EXPECT_FALSE(formatter.contains(hob::log::message_formatter::field::HOST));
+}
+
+TEST(message_formatter_test, format_substitutes_fields)
+{
+	hob::log::message_formatter formatter = {};
+	std::string					destination = "";
+
+	formatter.compile("[{TIME}] [{TAG}] {FILE:short} ({FILE:long}) {FUNCTION}:{LINE} {MESSAGE}!");
+	formatter.format(destination, hob::log::message_fields{ "12:00", "info", "/src/main.cpp", "main.cpp", "main", 42, "", "", "Hello" });
+
+	EXPECT_EQ("[12:00] [info] main.cpp (/src/main.cpp) main:42 Hello!", destination);
+}
+
+TEST(message_formatter_test, format_keeps_unknown_placeholders_and_repetitions)
+{
+	hob::log::message_formatter formatter = {};
+	std::string					destination = "prefix ";
+
+	EXPECT_THROW(formatter.compile("{MESSAGE"), std::invalid_argument);
+
+	formatter.compile("{UNKNOWN} {TAG}{TAG} {{MESSAGE}}");
+	formatter.format(destination, hob::log::message_fields{ "", "warn", "file.cpp", "file.cpp", "function", 1, "", "", "text" });
+
+	EXPECT_EQ("prefix {UNKNOWN} warnwarn {text}", destination);
+}
+
+TEST(message_formatter_test, format_uses_cached_process_fields)
+{
+	hob::log::message_formatter formatter	= {};
+	std::string					destination = "";
+
+	hob::log::process::refresh();
+	formatter.compile("{HOST}:{PID} {MESSAGE}");
+	formatter.format(destination, hob::log::message_fields{ "", "info", "file.cpp", "file.cpp", "function", 1, "", "", "text" });
+
+	EXPECT_FALSE(hob::log::process::get_host_name().empty());
+	EXPECT_EQ(std::string{ hob::log::process::get_host_name() } + ":" + std::to_string(getpid()) + " text", destination);
+}
+
+TEST(message_formatter_test, refresh_publishes_process_fields_while_they_are_read)
+{
+	std::string host_name = "";
+
+	hob::log::process::refresh();
+	host_name.assign(hob::log::process::get_host_name());
+
+	std::jthread refresher = std::jthread{ [](void) -> void
+										   {
+											   for (std::int32_t index = 0; index < 1000; ++index)
+											   {
+												   hob::log::process::refresh();
+											   }
+										   } };
+
+	for (std::int32_t index = 0; index < 1000; ++index)
+	{
+		ASSERT_EQ(host_name, hob::log::process::get_host_name());
+	}
+}
+
+TEST(message_formatter_test, format_uses_thread_name)
+{
+	hob::log::message_formatter formatter	= {};
+	std::string					destination = "";
+
+	formatter.compile("[{THREAD}|{THREAD_NAME}] {MESSAGE}");
+	hob::log::thread_info::set_thread_name("simulation-worker-1");
+	formatter.format(destination,
+					 hob::log::message_fields{
+						 "", "info", "file.cpp", "file.cpp", "function", 1, hob::log::thread_info::get_thread_id(), hob::log::thread_info::get_thread_name(), "text" });
+	hob::log::thread_info::set_thread_name("");
+
+	EXPECT_EQ("[" + std::string{ hob::log::thread_info::get_thread_id() } + "|simulation-worker-1] text", destination);
+}
+
+TEST(message_formatter_test, format_substitutes_context)
+{
+	hob::log::message_formatter formatter	= {};
+	std::string					destination = "";
+
+	formatter.compile("[{CONTEXT}] {MESSAGE}");
+	formatter.format(destination, hob::log::message_fields{ "", "info", "file.cpp", "file.cpp", "function", 1, "", "", "text", "match=7 turn=3" });
+
+	EXPECT_EQ("[match=7 turn=3] text", destination);
+}
+
+TEST(message_formatter_test, file_name_computed_at_compile_time)
+{
+	static constexpr std::string_view FILE_NAME = hob::log::details::get_file_name("/src/directory/main.cpp");
+
+	EXPECT_EQ("main.cpp", FILE_NAME);
+	EXPECT_EQ("main.cpp", hob::log::details::get_file_name("main.cpp"));
+}
@@ -0,0 +1,176 @@
+#include <thread>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "test_record.hpp"
+
+#include "types.hpp"
+#include "message_queue.cpp"
+#include "record.cpp"
+#include "utility.cpp"
+
+TEST(message_queue_test, capacity_rounded_up_to_power_of_two)
+{
+	ASSERT_EQ(2UL, hob::log::message_queue{ 0UL }.get_capacity());
+	ASSERT_EQ(8UL, hob::log::message_queue{ 5UL }.get_capacity());
+	ASSERT_EQ(4096UL, hob::log::message_queue{ 4096UL }.get_capacity());
+}
+
+TEST(message_queue_test, front_returns_records_in_order)
+{
+	hob::log::message_queue queue = hob::log::message_queue{ 4UL };
+
+	ASSERT_TRUE(queue.is_empty());
+	ASSERT_TRUE(queue.emplace(make_record("first")));
+	ASSERT_TRUE(queue.emplace(&callsite, std::make_shared<const std::string>("second\n")));
+	ASSERT_FALSE(queue.is_empty());
+
+	ASSERT_EQ("first", queue.front()->get().arguments);
+	ASSERT_EQ("1", queue.front()->get().thread_id);
+	queue.pop();
+
+	ASSERT_EQ("second\n", *queue.front()->get_line());
+	queue.pop();
+
+	ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(message_queue_test, emplace_fails_when_full_and_slots_are_reused)
+{
+	hob::log::message_queue queue = hob::log::message_queue{ 2UL };
+
+	ASSERT_TRUE(queue.emplace(make_record("1")));
+	ASSERT_TRUE(queue.emplace(make_record("2")));
+	ASSERT_FALSE(queue.emplace(make_record("3")));
+
+	queue.pop();
+	ASSERT_TRUE(queue.emplace(make_record("4")));
+
+	ASSERT_EQ("2", queue.front()->get().arguments);
+	queue.pop();
+	ASSERT_EQ("4", queue.front()->get().arguments);
+	queue.pop();
+	ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(message_queue_test, message_of_structured_record_is_copied)
+{
+	hob::log::message_queue queue	= hob::log::message_queue{ 2UL };
+	std::string				message = "runtime message";
+	hob::log::record		record	= make_record("fields");
+
+	record.format		 = message;
+	record.is_structured = true;
+	ASSERT_TRUE(queue.emplace(record));
+	message.assign(message.length(), 'x');
+
+	ASSERT_EQ("runtime message", queue.front()->get().format);
+	ASSERT_EQ("fields", queue.front()->get().arguments);
+	ASSERT_EQ("main", queue.front()->get().thread_name);
+	queue.pop();
+}
+
+TEST(message_queue_test, front_returns_nullptr_when_empty)
+{
+	hob::log::message_queue queue = hob::log::message_queue{ 2UL };
+
+	ASSERT_EQ(nullptr, queue.front());
+	ASSERT_TRUE(queue.emplace(make_record("late")));
+	ASSERT_EQ("late", queue.front()->get().arguments);
+	queue.pop();
+	ASSERT_EQ(nullptr, queue.front());
+}
+
+TEST(message_queue_test, front_batch_returns_ready_records_up_to_capacity)
+{
+	hob::log::message_queue							queue	= hob::log::message_queue{ 8UL };
+	std::array<const hob::log::stored_record*, 3UL>	records	= {};
+
+	ASSERT_EQ(0UL, queue.front(records));
+	for (std::size_t message = 0UL; message < 5UL; ++message)
+	{
+		ASSERT_TRUE(queue.emplace(make_record(std::to_string(message))));
+	}
+
+	ASSERT_EQ(3UL, queue.front(records));
+	ASSERT_EQ("0", records[0]->get().arguments);
+	ASSERT_EQ("2", records[2]->get().arguments);
+	queue.pop(3UL);
+
+	ASSERT_EQ(2UL, queue.front(records));
+	ASSERT_EQ("3", records[0]->get().arguments);
+	ASSERT_EQ("4", records[1]->get().arguments);
+	queue.pop(2UL);
+
+	ASSERT_EQ(0UL, queue.front(records));
+	ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(message_queue_test, consumer_receives_every_record_of_every_producer)
+{
+	static constexpr std::size_t PRODUCERS_COUNT = 8UL;
+	static constexpr std::size_t MESSAGES_COUNT	 = 20'000UL;
+	hob::log::message_queue		 queue			 = hob::log::message_queue{ 64UL };
+	std::vector<std::thread>	 producers		 = {};
+	std::vector<std::size_t>	 next_messages	 = std::vector<std::size_t>(PRODUCERS_COUNT, 0UL);
+	std::size_t					 consumed_count	 = 0UL;
+	std::atomic<bool>			 is_produced	 = false;
+	std::thread					 consumer		 = {};
+
+	consumer = std::thread{ [&queue, &next_messages, &consumed_count, &is_produced](void) -> void {
+		const hob::log::stored_record* record  = nullptr;
+		bool						   is_last = false;
+
+		while (true)
+		{
+			// Read before the queue, so the records emplaced right before the producers are done are not missed.
+			is_last = is_produced.load();
+			record	= queue.front();
+
+			if (nullptr == record)
+			{
+				if (true == is_last)
+				{
+					break;
+				}
+
+				std::this_thread::yield();
+				continue;
+			}
+
+			const std::string_view arguments = record->get().arguments;
+			const std::size_t	   producer	 = static_cast<std::size_t>(arguments[0] - 'a');
+
+			EXPECT_EQ(std::to_string(next_messages[producer]++), arguments.substr(1UL));
+			++consumed_count;
+			queue.pop();
+		}
+	} };
+
+	for (std::size_t producer = 0UL; producer < PRODUCERS_COUNT; ++producer)
+	{
+		producers.emplace_back([&queue, producer](void) -> void {
+			for (std::size_t message = 0UL; message < MESSAGES_COUNT; ++message)
+			{
+				const std::string arguments = static_cast<char>('a' + producer) + std::to_string(message);
+
+				while (false == queue.emplace(make_record(arguments)))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	for (std::thread& producer : producers)
+	{
+		producer.join();
+	}
+
+	is_produced.store(true);
+	consumer.join();
+
+	ASSERT_EQ(PRODUCERS_COUNT * MESSAGES_COUNT, consumed_count);
+}
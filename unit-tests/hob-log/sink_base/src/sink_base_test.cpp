@@ -0,0 +1,357 @@
+#include <atomic>
+#include <thread>
+#include <new>
+#include <cstdlib>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "test_record.hpp"
+
+#include "sink.cpp"
+#include "sink_base.cpp"
+#include "filter_chain.cpp"
+#include "message_formatter.cpp"
+#include "time_formatter.cpp"
+#include "process.cpp"
+#include "thread_info.cpp"
+#include "worker.cpp"
+#include "backend.cpp"
+#include "notifier.cpp"
+#include "message_queue.cpp"
+#include "merging_queue.cpp"
+#include "thread_queue.cpp"
+#include "record.cpp"
+#include "clock.cpp"
+#include "utility.cpp"
+
+static std::atomic<std::uint64_t> allocations_count = 0UL;
+
+void* operator new(const std::size_t size)
+{
+	void* const memory = std::malloc(0UL == size ? 1UL : size);
+
+	allocations_count.fetch_add(1UL, std::memory_order_relaxed);
+	return nullptr != memory ? memory : throw std::bad_alloc{};
+}
+
+void operator delete(void* const memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* const memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+class sink_test final : public hob::log::sink_base
+{
+public:
+	sink_test(const hob::log::sink_base_configuration& configuration, std::string* const transcript = nullptr)
+		: sink_base{ "test", configuration }
+		, messages_count{ 0UL }
+		, last_message{}
+		, transcript{ transcript }
+	{
+		last_message.reserve(256UL);
+	}
+
+	~sink_test(void) noexcept
+	{
+		flush_repeats();
+		stop_async_worker();
+	}
+
+private:
+	bool log(const std::uint8_t, const std::string_view message) noexcept override
+	{
+		++messages_count;
+		last_message.assign(message);
+		if (nullptr != transcript)
+		{
+			(void)transcript->append(message);
+		}
+		return true;
+	}
+
+public:
+	using sink_base::write_lines;
+
+	std::atomic<std::uint64_t> messages_count;
+	std::string				   last_message;
+	std::string*			   transcript;
+};
+
+TEST(sink_base_test, log_appends_new_line)
+{
+	sink_test		sink = { { "[{TAG}] {FUNCTION}: {MESSAGE}", "{HOUR:24}:{MINUTE}:{SECOND}", 0x3FU, false } };
+	hob::log::sink& base = sink;
+
+	base.log(make_record("message"));
+	EXPECT_EQ(1UL, sink.messages_count);
+	EXPECT_EQ("[info] function: message\n", sink.last_message);
+}
+
+TEST(sink_base_test, log_filtered_severity)
+{
+	sink_test		sink = { { "{MESSAGE}", "", hob::log::severity_level::ERROR, false } };
+	hob::log::sink& base = sink;
+
+	base.log(make_record("message"));
+	EXPECT_EQ(0UL, sink.messages_count);
+}
+
+TEST(sink_base_test, log_filtered_by_filters)
+{
+	sink_test			sink		   = { { "{MESSAGE}", "", 0x3FU, false } };
+	hob::log::sink&		base		   = sink;
+	const std::uint64_t filtered_count = callsite.filtered_count.load();
+
+	sink.set_filters({ { hob::log::sink_filter::field::FUNCTION, "function", false }, { hob::log::sink_filter::field::MESSAGE, "noise", true } });
+	base.log(make_record("message"));
+	base.log(make_record("noise"));
+	EXPECT_EQ(1UL, sink.messages_count);
+	EXPECT_EQ("message\n", sink.last_message);
+	EXPECT_EQ(filtered_count + 1UL, callsite.filtered_count.load());
+	EXPECT_EQ(2UL, sink.get_filters().size());
+}
+
+TEST(sink_base_test, log_formats_encoded_arguments)
+{
+	sink_test		 sink	   = { { "[{THREAD_NAME}] {MESSAGE}", "", 0x3FU, false } };
+	hob::log::sink&	 base	   = sink;
+	std::string		 arguments = "";
+	hob::log::record record	   = make_record("");
+
+	hob::log::details::serialize_argument(arguments, 42);
+	hob::log::details::serialize_argument(arguments, std::string{ "answer" });
+
+	record.format	 = "{} is the {}";
+	record.decode	 = &hob::log::details::deserialize<int, std::string>;
+	record.arguments = arguments;
+
+	base.log(record);
+	EXPECT_EQ("[main] 42 is the answer\n", sink.last_message);
+}
+
+TEST(sink_base_test, log_async_formats_copy_on_worker)
+{
+	sink_test		 sink	   = { { "[{THREAD_NAME}] {MESSAGE}", "", 0x3FU, true } };
+	hob::log::sink&	 base	   = sink;
+	std::string		 arguments = "";
+	std::string		 name	   = "producer";
+	hob::log::record record	   = make_record("");
+
+	hob::log::details::serialize_argument(arguments, std::string_view{ "deferred" });
+
+	record.thread_name = name;
+	record.format	   = "{} message";
+	record.decode	   = &hob::log::details::deserialize<std::string_view>;
+	record.arguments   = arguments;
+
+	base.log(record);
+	arguments.assign(arguments.length(), '\0');
+	name.assign(name.length(), '\0');
+
+	sink.set_async_mode(false);
+	EXPECT_EQ(1UL, sink.messages_count);
+	EXPECT_EQ("[producer] deferred message\n", sink.last_message);
+}
+
+TEST(sink_base_test, log_async_logs_every_record_of_a_batch)
+{
+	sink_test		sink = { { "{MESSAGE}", "", 0x3FU, true } };
+	hob::log::sink&	base = sink;
+
+	base.log(make_record("first"));
+	base.log(make_record("second"));
+	base.log(make_record("third"));
+
+	sink.set_async_mode(false);
+	EXPECT_EQ(3UL, sink.messages_count);
+	EXPECT_EQ("third\n", sink.last_message);
+}
+
+TEST(sink_base_test, write_lines_writes_the_batch_at_once)
+{
+	const std::string		  messages	 = "first\nsecond\n";
+	const hob::log::sink_line lines[]	 = { { 0x04U, { messages.data(), 6UL } }, { 0x04U, { messages.data() + 6UL, 7UL } } };
+	FILE* const				  stream	 = std::tmpfile();
+	char					  buffer[32] = {};
+
+	ASSERT_NE(nullptr, stream);
+	EXPECT_EQ(2UL, sink_test::write_lines(stream, lines));
+	EXPECT_EQ(0UL, sink_test::write_lines(stream, {}));
+
+	std::rewind(stream);
+	EXPECT_EQ(messages.length(), std::fread(buffer, 1UL, sizeof(buffer), stream));
+	EXPECT_EQ(messages, std::string_view(buffer, messages.length()));
+	std::fclose(stream);
+}
+
+TEST(sink_base_test, log_counts_unformattable_message_as_lost)
+{
+	std::string		 arguments = "";
+	hob::log::record record	   = make_record("");
+
+	// A negative dynamic width is only detected when the message is being formatted.
+	hob::log::details::serialize_argument(arguments, 42);
+	hob::log::details::serialize_argument(arguments, -1);
+
+	record.format	 = "{:{}}";
+	record.decode	 = &hob::log::details::deserialize<int, int>;
+	record.arguments = arguments;
+
+	for (const bool async_mode : { false, true })
+	{
+		sink_test			sink		  = { { "{MESSAGE}", "", 0x3FU, async_mode } };
+		hob::log::sink&		base		  = sink;
+		const std::uint64_t	dropped_count = callsite.dropped_count.load();
+
+		base.log(record);
+		base.log(make_record("next"));
+
+		sink.set_async_mode(false);
+		EXPECT_EQ(1UL, sink.messages_count);
+		EXPECT_EQ("next\n", sink.last_message);
+		EXPECT_EQ(1UL, sink.get_lost_logs());
+		EXPECT_EQ(dropped_count + 1UL, callsite.dropped_count.load());
+	}
+}
+
+TEST(sink_base_test, log_steady_state_does_not_allocate)
+{
+	sink_test	  sink					= { { "{TIME} [{TAG}] {FILE:short}:{LINE} {FUNCTION} {PID} {THREAD}: {MESSAGE}",
+											  "{YEAR}-{MONTH:numeric}-{DAY_MONTH} {HOUR:24}:{MINUTE}:{SECOND}.{MICROSECOND}",
+											  0x3FU,
+											  false } };
+	hob::log::sink& base					= sink;
+	std::uint64_t	allocations_count_start = 0UL;
+
+	base.log(make_record("warming up the buffers"));
+
+	allocations_count_start = allocations_count.load();
+	for (std::int32_t index = 0; index < 100; ++index)
+	{
+		base.log(make_record("steady state"));
+	}
+
+	EXPECT_EQ(101UL, sink.messages_count);
+	EXPECT_EQ(allocations_count_start, allocations_count.load());
+}
+
+TEST(sink_base_test, log_reports_suppressed_count)
+{
+	sink_test		 sink	= { { "{MESSAGE}", "", 0x3FU, false } };
+	hob::log::sink&	 base	= sink;
+	hob::log::record record = make_record("message");
+
+	record.suppressed_count = 41UL;
+
+	base.log(record);
+	EXPECT_EQ("message [41 similar messages suppressed]\n", sink.last_message);
+}
+
+TEST(sink_base_test, log_collapses_repeated_messages)
+{
+	sink_test		sink = { { "{MESSAGE}", "", 0x3FU, false, hob::log::timestamp_source::SYSTEM, 60'000U } };
+	hob::log::sink& base = sink;
+
+	for (std::int32_t index = 0; index < 1000; ++index)
+	{
+		base.log(make_record("storm"));
+	}
+	EXPECT_EQ(1UL, sink.messages_count);
+
+	base.log(make_record("calm"));
+	EXPECT_EQ(3UL, sink.messages_count);
+	EXPECT_EQ("calm\n", sink.last_message);
+}
+
+TEST(sink_base_test, set_collapse_timeout_reports_run_and_starts_new_one)
+{
+	sink_test		sink = { { "{MESSAGE}", "", 0x3FU, false, hob::log::timestamp_source::SYSTEM, 60'000U } };
+	hob::log::sink& base = sink;
+
+	base.log(make_record("storm"));
+	base.log(make_record("storm"));
+	base.log(make_record("storm"));
+	sink.set_collapse_timeout(30'000U);
+	EXPECT_EQ(2UL, sink.messages_count);
+	EXPECT_EQ("last message repeated 2 times\n", sink.last_message);
+
+	base.log(make_record("storm"));
+	base.log(make_record("storm"));
+	base.log(make_record("calm"));
+	EXPECT_EQ(5UL, sink.messages_count);
+	EXPECT_EQ("calm\n", sink.last_message);
+}
+
+TEST(sink_base_test, destroying_sink_reports_run_in_progress)
+{
+	for (const bool async_mode : { false, true })
+	{
+		std::string transcript = "";
+
+		{
+			sink_test		sink = { { "{MESSAGE}", "", 0x3FU, async_mode, hob::log::timestamp_source::SYSTEM, 60'000U }, &transcript };
+			hob::log::sink&	base = sink;
+
+			base.log(make_record("storm"));
+			base.log(make_record("storm"));
+			base.log(make_record("storm"));
+		}
+
+		EXPECT_EQ("storm\nlast message repeated 2 times\n", transcript);
+	}
+}
+
+TEST(sink_base_test, log_collapse_reports_expired_run_without_new_message)
+{
+	std::string		transcript = "";
+	sink_test		sink	   = { { "{THREAD_NAME}: {MESSAGE}", "", 0x3FU, false, hob::log::timestamp_source::SYSTEM, 1U }, &transcript };
+	hob::log::sink& base	   = sink;
+
+	base.log(make_record("storm"));
+	base.log(make_record("storm"));
+	for (std::int32_t attempt = 0; attempt < 1000 && 2UL > sink.messages_count; ++attempt)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+	}
+	EXPECT_EQ(2UL, sink.messages_count);
+
+	// Joins the thread reporting the expired runs, the run having been reported already.
+	sink.set_collapse_timeout(1U);
+	EXPECT_EQ("main: storm\nmain: last message repeated 1 times\n", transcript);
+}
+
+TEST(sink_base_test, log_collapse_reports_run_with_its_own_thread)
+{
+	std::string		 transcript = "";
+	sink_test		 sink		= { { "{THREAD_NAME}: {MESSAGE}", "", 0x3FU, false, hob::log::timestamp_source::SYSTEM, 60'000U }, &transcript };
+	hob::log::sink&	 base		= sink;
+	hob::log::record record		= make_record("calm");
+
+	base.log(make_record("storm"));
+	base.log(make_record("storm"));
+
+	record.thread_name = "other";
+	base.log(record);
+
+	EXPECT_EQ("main: storm\nmain: last message repeated 1 times\nother: calm\n", transcript);
+}
+
+TEST(sink_base_test, log_counts_callsite_statistics)
+{
+	sink_test			sink		   = { { "{MESSAGE}", "", hob::log::severity_level::INFO, false } };
+	hob::log::sink&		base		   = sink;
+	const std::uint64_t bytes_count	   = callsite.bytes_count.load();
+	const std::uint64_t filtered_count = callsite.filtered_count.load();
+
+	base.log(make_record("message"));
+	EXPECT_EQ(bytes_count + 8UL, callsite.bytes_count.load());
+
+	sink.set_severity_level(hob::log::severity_level::ERROR);
+	base.log(make_record("message"));
+	EXPECT_EQ(filtered_count + 1UL, callsite.filtered_count.load());
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include "test_record.hpp"
+
+#include "sink.cpp"
+#include "sink_base.cpp"
+#include "filter_chain.cpp"
+#include "sink_composed.cpp"
+#include "message_formatter.cpp"
+#include "time_formatter.cpp"
+#include "process.cpp"
+#include "thread_info.cpp"
+#include "worker.cpp"
+#include "backend.cpp"
+#include "notifier.cpp"
+#include "message_queue.cpp"
+#include "merging_queue.cpp"
+#include "thread_queue.cpp"
+#include "record.cpp"
+#include "clock.cpp"
+#include "utility.cpp"
+
+class sink_test final : public hob::log::sink_base
+{
+public:
+	sink_test(const hob::log::sink_base_configuration& configuration)
+		: sink_base{ "test", configuration }
+		, messages{}
+	{
+	}
+
+private:
+	bool log(const std::uint8_t, const std::string_view message) noexcept override;
+
+public:
+	std::vector<std::string> messages;
+};
+
+static std::vector<const sink_test*> journal = {};
+
+bool sink_test::log(const std::uint8_t, const std::string_view message) noexcept
+{
+	messages.emplace_back(message);
+	journal.push_back(this);
+	return true;
+}
+
+static std::uint64_t decodes_count = 0UL;
+
+static void count_decode(std::string& destination, const std::string_view, const std::string_view arguments)
+{
+	++decodes_count;
+	(void)destination.append(arguments);
+}
+
+static void throw_decode(std::string&, const std::string_view, const std::string_view)
+{
+	++decodes_count;
+	throw std::format_error{ "unformattable" };
+}
+
+static std::shared_ptr<sink_test> make_sink(const std::string_view format, const std::uint8_t severity_level, const bool async_mode)
+{
+	return std::make_shared<sink_test>(hob::log::sink_base_configuration{ format, "", severity_level, async_mode });
+}
+
+TEST(sink_composed_test, log_same_format_shares_line)
+{
+	const std::shared_ptr<sink_test> first	= make_sink("[{TAG}] {MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test> second = make_sink("[{TAG}] {MESSAGE}", 0x3FU, false);
+	hob::log::sink_composed			 sink	= { "composed", { first, second } };
+
+	sink.log(make_record("message"));
+	ASSERT_EQ(1UL, first->messages.size());
+	ASSERT_EQ(1UL, second->messages.size());
+	EXPECT_EQ("[info] message\n", first->messages.front());
+	EXPECT_EQ("[info] message\n", second->messages.front());
+}
+
+TEST(sink_composed_test, log_different_formats)
+{
+	const std::shared_ptr<sink_test> first	= make_sink("[{TAG}] {MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test> second = make_sink("{FUNCTION}: {MESSAGE}", 0x3FU, false);
+	hob::log::sink_composed			 sink	= { "composed", { first, second } };
+
+	sink.log(make_record("message"));
+	ASSERT_EQ(1UL, first->messages.size());
+	ASSERT_EQ(1UL, second->messages.size());
+	EXPECT_EQ("[info] message\n", first->messages.front());
+	EXPECT_EQ("function: message\n", second->messages.front());
+}
+
+TEST(sink_composed_test, log_filtered_severity_per_sink)
+{
+	const std::shared_ptr<sink_test> first	= make_sink("{MESSAGE}", hob::log::severity_level::ERROR, false);
+	const std::shared_ptr<sink_test> second = make_sink("{MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test> third	= make_sink("{MESSAGE}", 0x3FU, false);
+	hob::log::sink_composed			 sink	= { "composed", { first, second, third } };
+
+	sink.log(make_record("message"));
+	EXPECT_EQ(0UL, first->messages.size());
+	EXPECT_EQ(1UL, second->messages.size());
+	EXPECT_EQ(1UL, third->messages.size());
+}
+
+TEST(sink_composed_test, log_regroups_on_configuration_changed)
+{
+	const std::shared_ptr<sink_test> first	= make_sink("{MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test> second = make_sink("{MESSAGE}", 0x3FU, false);
+	hob::log::sink_composed			 sink	= { "composed", { first, second } };
+
+	second->set_format("[{TAG}] {MESSAGE}");
+	sink.on_configuration_changed();
+
+	sink.log(make_record("message"));
+	EXPECT_EQ("message\n", first->messages.front());
+	EXPECT_EQ("[info] message\n", second->messages.front());
+}
+
+TEST(sink_composed_test, log_async_sinks_share_line)
+{
+	const std::shared_ptr<sink_test> first	= make_sink("[{THREAD_NAME}] {MESSAGE}", 0x3FU, true);
+	const std::shared_ptr<sink_test> second = make_sink("[{THREAD_NAME}] {MESSAGE}", 0x3FU, true);
+	hob::log::sink_composed			 sink	= { "composed", { first, second } };
+	std::string						 name	= "producer";
+	hob::log::record				 record = make_record("message");
+
+	record.thread_name = name;
+	sink.log(record);
+	name.assign(name.length(), '\0');
+
+	first->set_async_mode(false);
+	second->set_async_mode(false);
+	ASSERT_EQ(1UL, first->messages.size());
+	ASSERT_EQ(1UL, second->messages.size());
+	EXPECT_EQ("[producer] message\n", first->messages.front());
+	EXPECT_EQ("[producer] message\n", second->messages.front());
+}
+
+TEST(sink_composed_test, log_single_accepting_sink_filters_once)
+{
+	const std::shared_ptr<sink_test> first				 = make_sink("{MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test> second				 = make_sink("{MESSAGE}", hob::log::severity_level::ERROR, false);
+	hob::log::sink_composed			 sink				 = { "composed", { first, second } };
+	hob::log::record				 record				 = make_record("message");
+	std::uint64_t					 decodes_count_start = decodes_count;
+
+	first->set_filters({ { hob::log::sink_filter::field::MESSAGE, "message", false } });
+	record.decode = &count_decode;
+
+	sink.log(record);
+	ASSERT_EQ(1UL, first->messages.size());
+	EXPECT_EQ(0UL, second->messages.size());
+	EXPECT_EQ("message\n", first->messages.front());
+
+	// Once by the filter matching the content and once for the line.
+	EXPECT_EQ(decodes_count_start + 2UL, decodes_count);
+}
+
+TEST(sink_composed_test, log_keeps_configuration_order)
+{
+	const std::shared_ptr<sink_test>			   first  = make_sink("{MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test>			   second = make_sink("[{TAG}] {MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test>			   third  = make_sink("{MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test>			   fourth = make_sink("{MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<hob::log::sink_composed> nested = std::make_shared<hob::log::sink_composed>("nested", std::list<std::shared_ptr<hob::log::sink>>{ third });
+	hob::log::sink_composed						   sink	  = { "composed", { first, second, nested, fourth } };
+
+	journal.clear();
+	sink.log(make_record("message"));
+
+	EXPECT_EQ((std::vector<const sink_test*>{ first.get(), second.get(), third.get(), fourth.get() }), journal);
+	EXPECT_EQ("message\n", fourth->messages.front());
+}
+
+TEST(sink_composed_test, log_unformattable_message_filters_once)
+{
+	const std::shared_ptr<sink_test> first				 = make_sink("{MESSAGE}", 0x3FU, false);
+	const std::shared_ptr<sink_test> second				 = make_sink("{MESSAGE}", 0x3FU, false);
+	hob::log::sink_composed			 sink				 = { "composed", { first, second } };
+	hob::log::record				 record				 = make_record("message");
+	std::uint64_t					 decodes_count_start = decodes_count;
+
+	first->set_filters({ { hob::log::sink_filter::field::MESSAGE, "message", false } });
+	second->set_filters({ { hob::log::sink_filter::field::MESSAGE, "message", false } });
+	record.decode = &throw_decode;
+
+	sink.log(record);
+	EXPECT_EQ(0UL, first->messages.size());
+	EXPECT_EQ(0UL, second->messages.size());
+
+	// Once by every filter, once for the shared line and once by every sink on its own.
+	EXPECT_EQ(decodes_count_start + 5UL, decodes_count);
+}
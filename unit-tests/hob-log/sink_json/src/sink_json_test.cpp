@@ -0,0 +1,120 @@
+#include <cstdio>
+#include <gtest/gtest.h>
+
+#include "test_record.hpp"
+
+#include "sink.cpp"
+#include "sink_base.cpp"
+#include "filter_chain.cpp"
+#include "sink_json.cpp"
+#include "message_formatter.cpp"
+#include "time_formatter.cpp"
+#include "process.cpp"
+#include "thread_info.cpp"
+#include "worker.cpp"
+#include "backend.cpp"
+#include "notifier.cpp"
+#include "message_queue.cpp"
+#include "merging_queue.cpp"
+#include "thread_queue.cpp"
+#include "record.cpp"
+#include "clock.cpp"
+#include "utility.cpp"
+
+static std::string escape(const std::string_view string)
+{
+	std::string destination = "";
+
+	hob::log::json::escape(destination, string);
+	return destination;
+}
+
+TEST(sink_json_test, escape_copies_plain_strings)
+{
+	ASSERT_EQ("", escape(""));
+	ASSERT_EQ("abc", escape("abc"));
+	ASSERT_EQ("The quick brown fox jumps over the lazy dog", escape("The quick brown fox jumps over the lazy dog"));
+	ASSERT_EQ("caf\xC3\xA9 \xE2\x82\xAC 12345678", escape("caf\xC3\xA9 \xE2\x82\xAC 12345678"));
+}
+
+TEST(sink_json_test, escape_escapes_special_characters_at_every_position)
+{
+	static constexpr std::string_view special_characters = "\"\\\n\r\t\x01\x1F";
+	static constexpr std::string_view escape_sequences[] = { "\\\"", "\\\\", "\\n", "\\r", "\\t", "\\u0001", "\\u001f" };
+
+	for (std::size_t index = 0UL; index < special_characters.length(); ++index)
+	{
+		for (std::size_t position = 0UL; position < 20UL; ++position)
+		{
+			std::string string = std::string(20UL, 'x');
+			std::string expected = std::string(position, 'x') + std::string{ escape_sequences[index] } + std::string(19UL - position, 'x');
+
+			string[position] = special_characters[index];
+			ASSERT_EQ(expected, escape(string));
+		}
+	}
+}
+
+TEST(sink_json_test, escape_handles_consecutive_special_characters)
+{
+	ASSERT_EQ("\\\"\\\"\\\"\\\"\\\"\\\"\\\"\\\"\\\"", escape("\"\"\"\"\"\"\"\"\""));
+	ASSERT_EQ("a\\\\b\\\\c\\\\d\\\\e", escape("a\\b\\c\\d\\e"));
+	ASSERT_EQ("\x7F\x80\xFF", escape("\x7F\x80\xFF"));
+}
+
+TEST(sink_json_test, format_message_serializes_structured_record)
+{
+	hob::log::sink_json sink	= { "json", { { "", "", 0x3FU, false }, stdout } };
+	std::string			fields	= "";
+	std::string			line	= "";
+	std::string			name	= "archer \"red\"";
+
+	hob::log::details::serialize_fields(fields, "unit_id", 42U, "hp", -7, "name", name, "alive", true, "speed", 1.0 / 0.0);
+	sink.format_message(line, hob::log::record{ &callsite, 0UL, 1234UL, "1", "main", "unit spawned", nullptr, fields, true, "", "", "" });
+
+	ASSERT_EQ("{\"timestamp\":1234,\"tag\":\"info\",\"file\":\"/path/to/file.cpp\",\"function\":\"function\",\"line\":1,\"thread\":\"1\",\"thread_name\":"
+			  "\"main\",\"message\":\"unit spawned\",\"fields\":{\"unit_id\":42,\"hp\":-7,\"name\":\"archer \\\"red\\\"\",\"alive\":true,\"speed\":null}}\n",
+			  line);
+}
+
+TEST(sink_json_test, format_message_serializes_plain_record)
+{
+	hob::log::sink_json sink = { "json", { { "[{TAG}] {MESSAGE}", "", 0x3FU, false }, stdout } };
+	std::string			line = "";
+
+	sink.format_message(line, hob::log::record{ &callsite, 2UL, 0UL, "1", "main", "path: C:\\", nullptr, "path: C:\\", false, "", "", "" });
+
+	ASSERT_EQ("{\"timestamp\":0,\"tag\":\"info\",\"file\":\"/path/to/file.cpp\",\"function\":\"function\",\"line\":1,\"thread\":\"1\",\"thread_name\":"
+			  "\"main\",\"message\":\"path: C:\\\\ [2 similar messages suppressed]\"}\n",
+			  line);
+}
+
+TEST(sink_json_test, format_message_serializes_context)
+{
+	hob::log::sink_json sink	= { "json", { { "", "", 0x3FU, false }, stdout } };
+	std::string			context = "";
+	std::string			line	= "";
+
+	hob::log::details::serialize_fields(context, "match", 7, "player", "red");
+	sink.format_message(line, hob::log::record{ &callsite, 0UL, 0UL, "1", "main", "turn ended", nullptr, "turn ended", false, "", "match=7 player=red", context });
+
+	ASSERT_EQ("{\"timestamp\":0,\"tag\":\"info\",\"file\":\"/path/to/file.cpp\",\"function\":\"function\",\"line\":1,\"thread\":\"1\",\"thread_name\":"
+			  "\"main\",\"message\":\"turn ended\",\"context\":{\"match\":7,\"player\":\"red\"}}\n",
+			  line);
+}
+
+TEST(sink_json_test, record_formats_fields_as_pairs)
+{
+	std::string fields	= "";
+	std::string message = "";
+
+	hob::log::details::serialize_fields(fields, "unit_id", 42U, "name", "archer", "alive", false);
+	hob::log::record{ &callsite, 0UL, 0UL, "1", "main", "unit spawned", nullptr, fields, true, "", "", "" }.format_message(message);
+
+	ASSERT_EQ("unit spawned unit_id=42 name=archer alive=false", message);
+}
+
+TEST(sink_json_test, constructor_throws_if_stream_is_nullptr)
+{
+	ASSERT_THROW(hob::log::sink_json("json", { { "", "", 0x3FU, false }, nullptr }), std::invalid_argument);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+
+#include "time_formatter.cpp"
+
+static constexpr std::string_view CALENDAR_FORMAT = "{YEAR}-{MONTH:numeric}-{DAY_MONTH} {HOUR:24}:{MINUTE}:{SECOND} {DAY_YEAR} {DAY_WEEK:numeric} {MONTH:short}";
+
+static std::string expected_calendar(const std::int64_t second)
+{
+	std::tm				   local_time = {};
+	std::time_t			   time		  = static_cast<std::time_t>(second);
+	std::array<char, 64UL> buffer	  = {};
+
+	(void)localtime_r(&time, &local_time);
+	(void)std::strftime(buffer.data(), buffer.size(), "%Y-%m-%d %H:%M:%S %j %w %b", &local_time);
+
+	return buffer.data();
+}
+
+TEST(time_formatter_test, empty_format_appends_nothing)
+{
+	hob::log::time_formatter formatter	 = {};
+	std::string				 destination = "";
+
+	formatter.compile("");
+	formatter.format(destination, 1'700'000'000'123'456'789L);
+
+	EXPECT_TRUE(destination.empty());
+}
+
+TEST(time_formatter_test, calendar_matches_localtime)
+{
+	hob::log::time_formatter formatter = {};
+
+	formatter.compile(CALENDAR_FORMAT);
+
+	for (const std::int64_t second : { 0L, 951'782'400L, 951'868'799L, 1'709'164'800L, 1'735'689'599L, 1'700'000'000L, 4'102'444'800L })
+	{
+		std::string destination = "";
+
+		formatter.format(destination, second * 1'000'000'000L);
+		EXPECT_EQ(expected_calendar(second), destination) << "second: " << second;
+	}
+}
+
+TEST(time_formatter_test, calendar_matches_localtime_in_other_time_zone)
+{
+	hob::log::time_formatter formatter	 = {};
+	std::string				 destination = "";
+
+	ASSERT_EQ(0, setenv("TZ", "Asia/Kolkata", 1));
+	tzset();
+
+	formatter.compile(CALENDAR_FORMAT);
+	formatter.format(destination, 1'700'000'000'000'000'000L);
+
+	EXPECT_EQ(expected_calendar(1'700'000'000L), destination);
+
+	ASSERT_EQ(0, unsetenv("TZ"));
+	tzset();
+}
+
+TEST(time_formatter_test, subsecond_fields_are_patched)
+{
+	hob::log::time_formatter formatter = {};
+	std::string				 first	   = "";
+	std::string				 second	   = "";
+
+	formatter.compile("{SECOND}.{MILLISECOND}|{MICROSECOND}|{NANOSECOND}|{EPOCH_NS}");
+	formatter.format(first, 1'700'000'000'001'002'003L);
+	formatter.format(second, 1'700'000'000'999'000'000L);
+
+	EXPECT_EQ(expected_calendar(1'700'000'000L).substr(17UL, 2UL) + ".001|001002|001002003|1700000000001002003", first);
+	EXPECT_EQ(expected_calendar(1'700'000'000L).substr(17UL, 2UL) + ".999|999000|999000000|1700000000999000000", second);
+}
+
+TEST(time_formatter_test, recompiling_invalidates_cache)
+{
+	hob::log::time_formatter formatter = {};
+	std::string				 first	   = "";
+	std::string				 second	   = "";
+
+	formatter.compile("[{HOUR:12} {MERIDIEM}]");
+	formatter.format(first, 0L);
+	formatter.compile("<{MONTH:long} {DAY_WEEK:long}>");
+	formatter.format(second, 0L);
+
+	EXPECT_EQ('[', first.front());
+	EXPECT_EQ('<', second.front());
+}
+
+TEST(time_formatter_test, more_formats_than_cache_entries)
+{
+	std::array<hob::log::time_formatter, hob::log::CACHE_ENTRIES + 2UL>	formatters	= {};
+	std::string															destination	= "";
+
+	for (std::size_t index = 0UL; index < formatters.size(); ++index)
+	{
+		formatters[index].compile(std::to_string(index) + " {YEAR}");
+	}
+
+	for (std::int32_t round = 0; round < 3; ++round)
+	{
+		for (std::size_t index = 0UL; index < formatters.size(); ++index)
+		{
+			destination.clear();
+			formatters[index].format(destination, 1'700'000'000'000'000'000L);
+			EXPECT_EQ(std::to_string(index) + " 2023", destination);
+		}
+	}
+}
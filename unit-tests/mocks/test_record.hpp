@@ -0,0 +1,20 @@
+#ifndef HOB_LOG_UNIT_TESTS_TEST_RECORD_HPP_
+#define HOB_LOG_UNIT_TESTS_TEST_RECORD_HPP_
+
+#include <string_view>
+#include <cstdint>
+
+#include "types.hpp"
+#include "callsite.hpp"
+#include "record.hpp"
+
+static constinit hob::log::details::callsite callsite = {
+	hob::log::severity_level::INFO, "info", "/path/to/file.cpp", "file.cpp", "function", 1, hob::log::details::callsite::ENABLED
+};
+
+static hob::log::record make_record(const std::string_view message, const std::uint64_t timestamp = 0UL)
+{
+	return hob::log::record{ &callsite, 0UL, timestamp, "1", "main", message, nullptr, message, false, "", "", "" };
+}
+
+#endif /*< HOB_LOG_UNIT_TESTS_TEST_RECORD_HPP_ */